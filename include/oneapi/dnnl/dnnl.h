@@ -438,6 +438,27 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the primitive attributes store mode.
+///
+/// @param attr Primitive attributes.
+/// @param mode Output store mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_store_mode(
+        const_dnnl_primitive_attr_t attr, dnnl_store_mode_t *mode);
+
+/// Sets primitive attributes store mode.
+///
+/// @param attr Primitive attributes.
+/// @param mode Store mode. The possible values are:
+///     #dnnl_store_mode_any (default),
+///     #dnnl_store_mode_regular,
+///     #dnnl_store_mode_nontemporal.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_store_mode(
+        dnnl_primitive_attr_t attr, dnnl_store_mode_t mode);
+
 /// Sets primitive attributes scaling factors for primitive operations for a
 /// given memory argument. The scaling factors must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -3888,6 +3909,29 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the number of shards in the primitive cache. Primitives are
+/// distributed across the shards by the hash of their descriptors, and
+/// lookups in different shards do not contend with each other.
+///
+/// @param num_shards Number of shards to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p num_shards value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_num_shards(int *num_shards);
+
+/// Returns the number of primitive cache hits and misses observed in a shard
+/// of the primitive cache since the library was loaded.
+///
+/// @param shard Index of the shard, from 0 to the number of shards returned
+///     by #dnnl_get_primitive_cache_num_shards() minus one.
+/// @param hits Number of cache hits in the shard.
+/// @param misses Number of cache misses in the shard.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p shard value is out of range or any of the output pointers is NULL,
+///     and #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_shard_stats(
+        int shard, uint64_t *hits, uint64_t *misses);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -4040,6 +4084,43 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Returns the amount of memory the library holds in a category and its
+/// high-water mark since the library was loaded.
+///
+/// @sa @ref dev_guide_memory_usage for more details
+///
+/// @param kind Memory category. #dnnl_memory_usage_total queries the sum
+///     over all categories.
+/// @param engine_kind Kind of the engine the memory belongs to.
+///     #dnnl_any_engine queries the sum over all engine kinds.
+/// @param bytes Current amount of memory in bytes. May be NULL.
+/// @param peak_bytes Maximum amount of memory in bytes observed so far. May
+///     be NULL.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p kind or @p engine_kind values are invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_memory_usage(dnnl_memory_usage_kind_t kind,
+        dnnl_engine_kind_t engine_kind, size_t *bytes, size_t *peak_bytes);
+
+/// Sets a budget on the total memory held by the library. When an entry is
+/// added to the primitive cache or to the graph constant tensor cache while
+/// the total memory is over the budget, the cache evicts entries until the
+/// total fits the budget or the cache is empty. Memory of other categories
+/// is not evicted.
+///
+/// @param bytes Budget in bytes. 0 stands for no budget, which is the
+///     default.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_memory_budget(size_t bytes);
+
+/// Returns the budget on the total memory held by the library.
+///
+/// @param bytes Budget in bytes, 0 if no budget is set.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p bytes value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_memory_budget(size_t *bytes);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -303,6 +303,26 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Store mode
+enum class store_mode {
+    /// The implementation decides whether to use non-temporal stores for the
+    /// destination depending on its size (default).
+    any = dnnl_store_mode_any,
+    /// The destination is written with regular stores.
+    regular = dnnl_store_mode_regular,
+    /// The destination is written with non-temporal (streaming) stores when
+    /// the implementation supports them.
+    nontemporal = dnnl_store_mode_nontemporal,
+};
+
+/// Converts a store mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API store mode enum value.
+/// @returns Corresponding C API store mode enum value.
+inline dnnl_store_mode_t convert_to_c(store_mode mode) {
+    return static_cast<dnnl_store_mode_t>(mode);
+}
+
 /// Rounding mode
 enum class rounding_mode {
     /// rounding mode dictated by the floating-point environment
@@ -604,6 +624,20 @@ enum class normalization_flags : unsigned {
     ///     When used with #dnnl::normalization_flags::use_global_stats,
     ///     only RMS norm is required to be provided as input.
     rms_norm = dnnl_rms_norm,
+
+    /// Add a residual tensor to the source before normalization. If
+    /// specified, the user is expected to pass the residual as
+    /// #DNNL_ARG_SRC_1 input on forward propagation. The residual has the
+    /// same memory descriptor as the source, and the statistics are computed
+    /// over the sum. Supported by layer normalization on forward propagation
+    /// only.
+    use_residual = dnnl_use_residual,
+
+    /// Output the sum of the source and the residual. If specified, the user
+    /// is expected to pass the #DNNL_ARG_DST_1 output on forward propagation,
+    /// which has the same memory descriptor as the source. The flag requires
+    /// #dnnl::normalization_flags::use_residual.
+    output_residual = dnnl_output_residual,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -4325,6 +4359,23 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the store mode.
+    store_mode get_store_mode() const {
+        dnnl_store_mode_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_store_mode(get(), &result),
+                "could not get store mode primitive attribute");
+        return store_mode(result);
+    }
+
+    /// Sets store mode.
+    ///
+    /// @param mode Specified store mode.
+    void set_store_mode(store_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_store_mode(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set store mode primitive attribute");
+    }
+
     /// Sets scaling factors for primitive operations for a given memory
     /// argument. The scaling factors must be passed at execution time
     /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -14203,6 +14254,52 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_memory_usage_kind_t
+enum class memory_usage_kind {
+    /// @copydoc dnnl_memory_usage_primitives
+    primitives = dnnl_memory_usage_primitives,
+    /// @copydoc dnnl_memory_usage_scratchpad
+    scratchpad = dnnl_memory_usage_scratchpad,
+    /// @copydoc dnnl_memory_usage_jit_code
+    jit_code = dnnl_memory_usage_jit_code,
+    /// @copydoc dnnl_memory_usage_constant_cache
+    constant_cache = dnnl_memory_usage_constant_cache,
+    /// @copydoc dnnl_memory_usage_total
+    total = dnnl_memory_usage_total,
+};
+
+/// Returns the amount of memory in bytes the library holds in a category.
+///
+/// @param kind Memory category.
+/// @param akind Kind of the engine the memory belongs to. #engine::kind::any
+///     queries the sum over all engine kinds.
+/// @param peak If true, returns the high-water mark instead of the current
+///     amount.
+inline size_t get_memory_usage(memory_usage_kind kind,
+        engine::kind akind = engine::kind::any, bool peak = false) {
+    size_t bytes = 0, peak_bytes = 0;
+    error::wrap_c_api(
+            dnnl_get_memory_usage(static_cast<dnnl_memory_usage_kind_t>(kind),
+                    static_cast<dnnl_engine_kind_t>(akind), &bytes,
+                    &peak_bytes),
+            "could not get memory usage");
+    return peak ? peak_bytes : bytes;
+}
+
+/// @copydoc dnnl_set_memory_budget()
+inline void set_memory_budget(size_t bytes) {
+    error::wrap_c_api(
+            dnnl_set_memory_budget(bytes), "could not set memory budget");
+}
+
+/// @copydoc dnnl_get_memory_budget()
+inline size_t get_memory_budget() {
+    size_t bytes = 0;
+    error::wrap_c_api(
+            dnnl_get_memory_budget(&bytes), "could not get memory budget");
+    return bytes;
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -14284,6 +14381,22 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// @copydoc dnnl_get_primitive_cache_num_shards(int *num_shards)
+inline int get_primitive_cache_num_shards() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_num_shards(&result),
+            "could not get primitive cache number of shards");
+    return result;
+}
+
+/// @copydoc dnnl_get_primitive_cache_shard_stats(int shard, uint64_t *hits, uint64_t *misses)
+inline void get_primitive_cache_shard_stats(
+        int shard, uint64_t &hits, uint64_t &misses) {
+    error::wrap_c_api(
+            dnnl_get_primitive_cache_shard_stats(shard, &hits, &misses),
+            "could not get primitive cache shard statistics");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
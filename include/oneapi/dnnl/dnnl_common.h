@@ -85,6 +85,30 @@ dnnl_status_t DNNL_API dnnl_engine_destroy(dnnl_engine_t engine);
 dnnl_status_t DNNL_API dnnl_stream_create(
         dnnl_stream_t *stream, dnnl_engine_t engine, unsigned flags);
 
+/// Creates an execution stream for a CPU engine that executes primitives on
+/// persistent worker threads pinned to the specified set of cores.
+/// Primitives executed on the stream use only the specified cores, which
+/// allows several streams to run concurrently without oversubscription.
+///
+/// Streams created with the #dnnl_stream_in_order flag still execute
+/// primitives synchronously from the user perspective, while streams created
+/// with the #dnnl_stream_out_of_order flag execute them asynchronously.
+///
+/// @note
+///     The functionality is supported only on Linux for CPU engines with
+///     OpenMP or sequential threading runtimes.
+///
+/// @param stream Output execution stream.
+/// @param engine CPU engine to create the execution stream on.
+/// @param flags Stream behavior flags (@sa dnnl_stream_flags_t).
+/// @param ncores Number of cores in the @p cores array.
+/// @param cores Array of logical core indices the stream is bound to.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_create_with_cpu_affinity(
+        dnnl_stream_t *stream, dnnl_engine_t engine, unsigned flags,
+        int ncores, const int *cores);
+
 /// Returns the engine of a stream object.
 ///
 /// @param stream Stream object.
@@ -324,7 +324,8 @@ struct stream : public handle<dnnl_stream_t> {
     enum class flags : unsigned {
         /// In-order execution.
         in_order = dnnl_stream_in_order,
-        /// Out-of-order execution.
+        /// Out-of-order execution. See #dnnl_stream_out_of_order for the
+        /// behavior on CPU engines.
         out_of_order = dnnl_stream_out_of_order,
         /// Default stream configuration.
         default_flags = dnnl_stream_default_flags,
@@ -352,6 +353,23 @@ struct stream : public handle<dnnl_stream_t> {
         reset(stream);
     }
 
+    /// Constructs a stream for the specified CPU engine that executes
+    /// primitives on worker threads pinned to the specified cores.
+    ///
+    /// @param aengine CPU engine to create the stream on.
+    /// @param cpu_cores Logical core indices the stream is bound to.
+    /// @param aflags Flags controlling stream behavior.
+    stream(const engine &aengine, const std::vector<int> &cpu_cores,
+            flags aflags = flags::default_flags) {
+        dnnl_stream_t stream;
+        error::wrap_c_api(
+                dnnl_stream_create_with_cpu_affinity(&stream, aengine.get(),
+                        static_cast<dnnl_stream_flags_t>(aflags),
+                        static_cast<int>(cpu_cores.size()), cpu_cores.data()),
+                "could not create a stream with cpu affinity");
+        reset(stream);
+    }
+
     /// Returns the associated engine.
     engine get_engine() const {
         dnnl_engine_t c_engine;
@@ -206,7 +206,11 @@ typedef const struct dnnl_engine *const_dnnl_engine_t;
 typedef enum {
     // In-order execution.
     dnnl_stream_in_order = 0x1U,
-    /// Out-of-order execution.
+    /// Out-of-order execution. On CPU engines with OpenMP, TBB or sequential
+    /// runtimes, primitives are executed asynchronously by worker threads
+    /// owned by the stream. Dependencies between primitives are inferred from
+    /// their memory arguments, and the memory objects must stay valid until
+    /// the stream is waited on.
     dnnl_stream_out_of_order = 0x2U,
     /// Default stream configuration.
     dnnl_stream_default_flags = dnnl_stream_in_order,
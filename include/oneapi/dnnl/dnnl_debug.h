@@ -45,6 +45,7 @@ const char DNNL_API *dnnl_alg_kind2str(dnnl_alg_kind_t v);
 const char DNNL_API *dnnl_rnn_flags2str(dnnl_rnn_flags_t v);
 const char DNNL_API *dnnl_rnn_direction2str(dnnl_rnn_direction_t v);
 const char DNNL_API *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v);
+const char DNNL_API *dnnl_store_mode2str(dnnl_store_mode_t v);
 const char DNNL_API *dnnl_rounding_mode2str(dnnl_rounding_mode_t v);
 const char DNNL_API *dnnl_quantization_mode2str(dnnl_quantization_mode_t v);
 const char DNNL_API *dnnl_cpu_isa2str(dnnl_cpu_isa_t v);
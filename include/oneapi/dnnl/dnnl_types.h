@@ -2318,6 +2318,20 @@ typedef enum {
     ///     When used with #dnnl_use_global_stats,
     ///     only RMS norm is required to be provided as input.
     dnnl_rms_norm = 0x20U,
+
+    /// Add a residual tensor to the source before normalization. If
+    /// specified, the user is expected to pass the residual as
+    /// #DNNL_ARG_SRC_1 input on forward propagation. The residual has the
+    /// same memory descriptor as the source, and the statistics are computed
+    /// over the sum. Supported by layer normalization on forward propagation
+    /// only.
+    dnnl_use_residual = 0x40U,
+
+    /// Output the sum of the source and the residual. If specified, the user
+    /// is expected to pass the #DNNL_ARG_DST_1 output on forward propagation,
+    /// which has the same memory descriptor as the source. The flag requires
+    /// #dnnl_use_residual.
+    dnnl_output_residual = 0x80U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2457,6 +2471,21 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Store mode
+typedef enum {
+    /// The implementation decides whether to use non-temporal stores for the
+    /// destination depending on its size (default). Streaming stores are
+    /// used when the destination is much larger than the last level cache.
+    dnnl_store_mode_any,
+    /// The destination is written with regular stores, so that it stays in
+    /// the cache for the consumers that read it right away.
+    dnnl_store_mode_regular,
+    /// The destination is written with non-temporal (streaming) stores when
+    /// the implementation supports them. This mode avoids read-for-ownership
+    /// traffic and cache pollution for outputs that are not read again soon.
+    dnnl_store_mode_nontemporal,
+} dnnl_store_mode_t;
+
 /// Rounding mode
 typedef enum {
     /// rounding mode dictated by the floating-point environment
@@ -3030,6 +3059,25 @@ typedef enum {
     dnnl_cpu_isa_prefer_ymm = 0x1,
 } dnnl_cpu_isa_hints_t;
 
+/// Categories of the memory held by the library.
+typedef enum {
+    /// Memory allocated by primitives, such as packed weights and lookup
+    /// tables, including primitives held by the library caches
+    dnnl_memory_usage_primitives = 0x0,
+
+    /// Scratchpads managed by the library
+    dnnl_memory_usage_scratchpad = 0x1,
+
+    /// Code of CPU just-in-time generated kernels
+    dnnl_memory_usage_jit_code = 0x2,
+
+    /// Buffers of the graph constant tensor cache
+    dnnl_memory_usage_constant_cache = 0x3,
+
+    /// Sum of all categories
+    dnnl_memory_usage_total = 0x4,
+} dnnl_memory_usage_kind_t;
+
 /// @} dnnl_api_service
 
 /// @} dnnl_api
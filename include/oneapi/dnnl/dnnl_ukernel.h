@@ -74,6 +74,19 @@ dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_A_scales(
 dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_B_scales(
         dnnl_ukernel_attr_params_t attr_params, const void *b_scales);
 
+/// Sets tensor B zero points argument to a storage.
+///
+/// The argument is used by transform objects decompressing integer B. Zero
+/// points are expected in the layout defined by
+/// `dnnl_transform_set_B_zero_points`.
+///
+/// @param attr_params Memory pointers storage object.
+/// @param b_zero_points Pointer to the zero points storage.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_attr_params_set_B_zero_points(
+        dnnl_ukernel_attr_params_t attr_params, const void *b_zero_points);
+
 /// Sets tensor D scales argument to a storage.
 ///
 /// @param attr_params Memory pointers storage object.
@@ -255,6 +268,28 @@ dnnl_status_t DNNL_API dnnl_brgemm_execute(const_dnnl_brgemm_t brgemm,
         const void *A_ptr, const void *B_ptr, const dnnl_dim_t *A_B_offsets,
         void *C_ptr, void *scratchpad_ptr);
 
+/// Executes a BRGeMM ukernel object for a list of problems.
+///
+/// The call is equivalent to a sequence of `dnnl_brgemm_execute` calls, one per
+/// problem, but the per-call overhead is paid once for the whole list. When
+/// @p nthr is greater than one, problems are split evenly between @p nthr
+/// threads of the library threading runtime, each of them setting up the
+/// hardware context on its own. In this case problems must not write to
+/// overlapping C buffers.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param problems Array of problems to execute.
+/// @param nproblems Number of problems in @p problems.
+/// @param scratchpad_ptr Pointer to a scratchpad buffer. Its size must be at
+///     least @p nthr times the size returned by
+///     `dnnl_brgemm_get_scratchpad_size`.
+/// @param nthr Number of threads to execute the problems with.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_execute_batch(const_dnnl_brgemm_t brgemm,
+        const dnnl_brgemm_problem_t *problems, dnnl_dim_t nproblems,
+        void *scratchpad_ptr, int nthr);
+
 /// Executes a BRGeMM ukernel object with post operations.
 ///
 /// @param brgemm BRGeMM ukernel object.
@@ -298,7 +333,9 @@ dnnl_status_t DNNL_API dnnl_brgemm_destroy(dnnl_brgemm_t brgemm);
 /// @param in_ld Input leading dimension.
 /// @param out_ld Output leading dimension. When packing data, it specifies a
 ///     block by N dimension.
-/// @param in_dt Input data type.
+/// @param in_dt Input data type. When it is one of `dnnl_s8`, `dnnl_u8`,
+///     `dnnl_s4`, or `dnnl_u4` and differs from @p out_dt, the input is
+///     decompressed to @p out_dt. Packed 4-bit values are stored two per byte.
 /// @param out_dt Output data type.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
@@ -307,6 +344,45 @@ dnnl_status_t DNNL_API dnnl_transform_create(dnnl_transform_t *transform,
         dnnl_dim_t in_ld, dnnl_dim_t out_ld, dnnl_data_type_t in_dt,
         dnnl_data_type_t out_dt);
 
+/// Sets tensor B scales to a transform object decompressing integer B.
+///
+/// Scales are applied to the input values converted to the output data type,
+/// after the zero points are subtracted. Mask bit `0` corresponds to the K
+/// dimension and bit `1` corresponds to the N dimension. When bit `0` is set,
+/// a single scale is shared by @p k_group_size consecutive rows of B, and
+/// scales are expected as a dense `[K / k_group_size, N]` array (the N
+/// dimension is dropped when bit `1` is not set).
+///
+/// @param transform Transform object.
+/// @param b_scale_mask Tensor B scale mask. Can be `0`, `1`, `2`, or `3`.
+/// @param k_group_size Number of rows sharing a scale. Ignored when bit `0`
+///     of @p b_scale_mask is not set.
+/// @param b_scale_dt Scales data type. Can be `dnnl_f32`, `dnnl_bf16`, or
+///     `dnnl_f16`.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_set_B_scales(dnnl_transform_t transform,
+        int b_scale_mask, dnnl_dim_t k_group_size,
+        dnnl_data_type_t b_scale_dt);
+
+/// Sets tensor B zero points to a transform object decompressing integer B.
+///
+/// Mask and groups semantics are the same as for
+/// `dnnl_transform_set_B_scales`. When both are set with bit `0`, the group
+/// sizes must match.
+///
+/// @param transform Transform object.
+/// @param b_zp_mask Tensor B zero points mask. Can be `0`, `1`, `2`, or `3`.
+/// @param k_group_size Number of rows sharing a zero point. Ignored when bit
+///     `0` of @p b_zp_mask is not set.
+/// @param b_zp_dt Zero points data type. Can be `dnnl_s32`, `dnnl_s8`,
+///     `dnnl_u8`, `dnnl_s4`, or `dnnl_u4`.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_set_B_zero_points(
+        dnnl_transform_t transform, int b_zp_mask, dnnl_dim_t k_group_size,
+        dnnl_data_type_t b_zp_dt);
+
 /// Generates an executable part of transform object.
 /// @param transform Transform object.
 /// @returns #dnnl_success on success and a status describing the error
@@ -323,6 +399,19 @@ dnnl_status_t DNNL_API dnnl_transform_generate(dnnl_transform_t transform);
 dnnl_status_t DNNL_API dnnl_transform_execute(
         const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr);
 
+/// Executes a transform object with scales and zero points arguments.
+///
+/// @param transform Transform object.
+/// @param in_ptr Pointer to an input buffer.
+/// @param out_ptr Pointer to an output buffer.
+/// @param attr_params Ukernel attributes memory storage. B scales and B zero
+///     points are taken from it when set to @p transform.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_execute_ext(
+        const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr,
+        const_dnnl_ukernel_attr_params_t attr_params);
+
 /// Destroys a transform object.
 ///
 /// @param transform Transform object.
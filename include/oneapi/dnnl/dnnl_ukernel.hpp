@@ -136,6 +136,16 @@ struct attr_params : public handle<dnnl_ukernel_attr_params_t> {
             error::wrap_c_api(status, "could not set B scales argument");
     }
 
+    /// Sets tensor B zero points arguments to a storage.
+    ///
+    /// @param b_zero_points Pointer to zero points storage.
+    void set_B_zero_points(const void *b_zero_points) {
+        dnnl_status_t status = dnnl_ukernel_attr_params_set_B_zero_points(
+                get(), b_zero_points);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B zero points argument");
+    }
+
     /// Sets tensor D scales arguments to a storage.
     ///
     /// @param d_scales Pointer to scales storage.
@@ -356,6 +366,28 @@ struct brgemm : public handle<dnnl_brgemm_t> {
                     status, "could not execute a BRGeMM ukernel object");
     }
 
+    /// Executes a BRGeMM ukernel object for a list of problems.
+    ///
+    /// Equivalent to a sequence of execute calls, one per problem, with the
+    /// per-call overhead paid once for the whole list.
+    ///
+    /// @param problems Vector of problems to execute.
+    /// @param scratchpad Pointer to a scratchpad buffer. Its size must be at
+    ///     least @p nthr times the size returned by
+    ///     @ref brgemm::get_scratchpad_size.
+    /// @param nthr Number of threads to split the problems between. The
+    ///     problems must not write to overlapping C buffers when @p nthr is
+    ///     greater than one.
+    void execute(const std::vector<dnnl_brgemm_problem_t> &problems,
+            void *scratchpad, int nthr = 1) const {
+        dnnl_status_t status = dnnl_brgemm_execute_batch(get(),
+                problems.data(), (memory::dim)problems.size(), scratchpad,
+                nthr);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
     /// Executes a BRGeMM ukernel object with post operations.
     ///
     /// @param A Base pointer to a tensor A.
@@ -437,6 +469,38 @@ struct transform : public handle<dnnl_transform_t> {
         reset(transform);
     }
 
+    /// Sets tensor B scales to a transform object decompressing integer B.
+    ///
+    /// Mask bit `0` corresponds to the K dimension and bit `1` corresponds to
+    /// the N dimension. When bit `0` is set, a single scale is shared by
+    /// @p k_group_size consecutive rows of B.
+    ///
+    /// @param b_scale_mask Tensor B scale mask. Can be `0`, `1`, `2`, or `3`.
+    /// @param k_group_size Number of rows sharing a scale.
+    /// @param b_scale_dt Scales data type.
+    void set_B_scales(int b_scale_mask, memory::dim k_group_size = 1,
+            memory::data_type b_scale_dt = memory::data_type::f32) {
+        dnnl_status_t status = dnnl_transform_set_B_scales(get(),
+                b_scale_mask, k_group_size, memory::convert_to_c(b_scale_dt));
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B scales");
+    }
+
+    /// Sets tensor B zero points to a transform object decompressing integer
+    /// B.
+    ///
+    /// @param b_zp_mask Tensor B zero points mask. Can be `0`, `1`, `2`, or
+    ///     `3`.
+    /// @param k_group_size Number of rows sharing a zero point.
+    /// @param b_zp_dt Zero points data type.
+    void set_B_zero_points(int b_zp_mask, memory::dim k_group_size = 1,
+            memory::data_type b_zp_dt = memory::data_type::s32) {
+        dnnl_status_t status = dnnl_transform_set_B_zero_points(get(),
+                b_zp_mask, k_group_size, memory::convert_to_c(b_zp_dt));
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B zero points");
+    }
+
     /// Generates an executable part of transform object.
     void generate() {
         dnnl_status_t status = dnnl_transform_generate(get());
@@ -455,6 +519,20 @@ struct transform : public handle<dnnl_transform_t> {
             error::wrap_c_api(status,
                     "could not execute a BRGeMM ukernel packing B object");
     }
+
+    /// Executes a transform object with scales and zero points arguments.
+    ///
+    /// @param in Pointer to an input buffer.
+    /// @param out Pointer to an output buffer.
+    /// @param params Ukernel attributes memory storage with B scales and B
+    ///     zero points arguments.
+    void execute(const void *in, void *out, const attr_params &params) const {
+        dnnl_status_t status
+                = dnnl_transform_execute_ext(get(), in, out, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not execute a BRGeMM ukernel packing B object");
+    }
 };
 
 /// @} dnnl_api_ukernel_transform
@@ -69,6 +69,19 @@ typedef struct dnnl_brgemm *dnnl_brgemm_t;
 /// A constant brgemm ukernel handle.
 typedef const struct dnnl_brgemm *const_dnnl_brgemm_t;
 
+/// A single problem of a batched brgemm ukernel execution.
+typedef struct {
+    /// Base pointer to a tensor A.
+    const void *A;
+    /// Base pointer to a tensor B.
+    const void *B;
+    /// Pointer to the set of tensor A and tensor B offsets for each batch
+    /// element, in the same format as for `dnnl_brgemm_execute`.
+    const dnnl_dim_t *A_B_offsets;
+    /// Pointer to a tensor C (accumulation buffer).
+    void *C;
+} dnnl_brgemm_problem_t;
+
 /// @} dnnl_api_ukernel_brgemm
 
 /// @addtogroup dnnl_api_ukernel_transform
@@ -208,6 +208,13 @@ const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
 } // namespace scratchpad_mode
 
+using store_mode_t = dnnl_store_mode_t;
+namespace store_mode {
+const store_mode_t any = dnnl_store_mode_any;
+const store_mode_t regular = dnnl_store_mode_regular;
+const store_mode_t nontemporal = dnnl_store_mode_nontemporal;
+} // namespace store_mode
+
 using rounding_mode_t = dnnl_rounding_mode_t;
 namespace rounding_mode {
 const rounding_mode_t environment = dnnl_rounding_mode_environment;
@@ -1970,6 +1977,8 @@ const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
 const normalization_flags_t rms_norm = dnnl_rms_norm;
+const normalization_flags_t use_residual = dnnl_use_residual;
+const normalization_flags_t output_residual = dnnl_output_residual;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
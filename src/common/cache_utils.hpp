@@ -18,19 +18,15 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-#include "cpu/platform.hpp"
-#else
-#include <chrono>
-#endif
-
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -121,7 +117,18 @@ protected:
     }
 };
 
-// The cache uses LRU replacement policy
+// The cache approximates LRU replacement policy with the CLOCK algorithm.
+//
+// Entries are distributed across a fixed number of shards by the hash of the
+// key, and each shard is guarded by its own lock. Lookups take a shared lock
+// of a single shard and only set a reference bit of the entry, so hits and
+// misses for keys from different shards do not contend with each other.
+//
+// The capacity is global. When an insertion exceeds it, entries are evicted
+// from shards in a round-robin fashion: within a shard the CLOCK hand sweeps
+// the buckets, clears reference bits, and evicts the first entry that has not
+// been referenced since the previous sweep. Eviction locks one shard at a
+// time and never blocks lookups in other shards.
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
@@ -130,23 +137,34 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
 
-    ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+    static constexpr int num_shards = 16;
+
+    struct shard_stats_t {
+        uint64_t hits;
+        uint64_t misses;
+    };
 
+    // `is_over_budget`, if provided, makes insertions evict entries while it
+    // returns true, in addition to the capacity limit.
+    lru_cache_t(int capacity, bool (*is_over_budget)() = nullptr)
+        : capacity_(capacity), is_over_budget_(is_over_budget) {}
+
+    ~lru_cache_t() override {
         if (!is_destroying_cache_safe()) {
-            // It is safe to remove those entries that are not affected by the
-            // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &shard : shards_) {
+                // It is safe to remove those entries that are not affected by
+                // the unloading order issue e.g. native CPU.
+                for (auto it = shard.mapper.begin();
+                        it != shard.mapper.end();) {
+                    if (!it->first.has_runtime_dependencies()) {
+                        it = shard.mapper.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
+                shard.release();
             }
-            release_cache();
             return;
         }
     }
@@ -154,108 +172,120 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     cache_object_t get(const key_t &key) override {
         value_t e;
         {
-            utils::lock_read_t lock_r(this->rw_mutex());
+            auto &shard = get_shard(key);
+            utils::lock_read_t lock_r(shard.mutex);
             if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            e = shard.get_future(key);
         }
 
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    }
+    int get_capacity() const override { return capacity_; }
 
     status_t set_capacity(int capacity) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        // Serializes capacity updates, lookups are not affected
+        std::lock_guard<std::mutex> lock(capacity_mutex_);
         capacity_ = capacity;
-        // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
-            // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
-            evict(n_excess_entries);
+        if (capacity_ == 0) {
+            for (auto &shard : shards_) {
+                utils::lock_write_t lock_w(shard.mutex);
+                size_ -= (int)shard.mapper.size();
+                shard.mapper.clear();
+            }
+            return status::success;
         }
+        // Evict excess entries if the new capacity is smaller
+        evict_excess();
         return status::success;
     }
-    void set_capacity_without_clearing(int capacity) {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
-    }
+    void set_capacity_without_clearing(int capacity) { capacity_ = capacity; }
+
+    int get_size() const override { return size_; }
 
-    int get_size() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+    // Returns the number of hits and misses in `get_or_add` per shard.
+    shard_stats_t get_shard_stats(int shard) const {
+        assert(shard >= 0 && shard < num_shards);
+        return {shards_[shard].hits.load(std::memory_order_relaxed),
+                shards_[shard].misses.load(std::memory_order_relaxed)};
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
-
     value_t get_or_add(const key_t &key, const value_t &value) override {
+        auto &shard = get_shard(key);
         {
             // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
+            utils::lock_read_t lock_r(shard.mutex);
             // Check if the cache is enabled.
             if (capacity_ == 0) { return value_t(); }
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
-            auto e = get_future(key);
-            if (e.valid()) { return e; }
+            auto e = shard.get_future(key);
+            if (e.valid()) {
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return e;
+            }
         }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
-        // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
-
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
-        if (!e.valid()) {
+        value_t e;
+        {
+            utils::lock_write_t lock_w(shard.mutex);
+            // 2. Section with exclusive access (write lock).
+            // In a multithreaded scenario, in the context of one thread the
+            // cache may have changed by another thread between releasing the
+            // read lock and acquiring the write lock (a.k.a. ABA problem),
+            // therefore additional checks have to be performed for
+            // correctness. Double check the capacity due to possible race
+            // condition
+            if (capacity_ == 0) { return value_t(); }
+
+            // Double check if the requested entry is present in the cache
+            // (unlikely cache_hit).
+            e = shard.get_future(key);
+            if (e.valid()) {
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return e;
+            }
             // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+            shard.misses.fetch_add(1, std::memory_order_relaxed);
+            shard.add(key, value);
+            size_++;
         }
+        // Eviction locks other shards, so it is done outside of the lock of
+        // the current one to avoid lock order inversion.
+        if (is_over_capacity()) evict_excess();
         return e;
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &shard = get_shard(key);
+        utils::lock_write_t lock_w(shard.mutex);
 
         if (capacity_ == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto it = shard.mapper.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == shard.mapper.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        shard.mapper.erase(it);
+        size_--;
     }
 
 private:
-    static size_t get_timestamp() {
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-        return cpu::platform::get_timestamp();
-#else
-        return std::chrono::steady_clock::now().time_since_epoch().count();
-#endif
-    }
-
     void update_entry(const key_t &key, const object_t &p) override {
         // Cast to void as compilers may warn about comparing compile time
         // constant function pointers with nullptr, as that is often not an
         // intended behavior
         if ((void *)key_merge == nullptr) return;
 
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &shard = get_shard(key);
+        utils::lock_write_t lock_w(shard.mutex);
 
         if (capacity_ == 0) { return; }
 
@@ -264,8 +294,8 @@ private:
         //    by another thread
         // 2. After the requested entry had been evicted it was inserted again
         //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
+        auto it = shard.mapper.find(key);
+        if (it == shard.mapper.end()
                 || it->first.thread_id() != key.thread_id()) {
             return;
         }
@@ -273,94 +303,114 @@ private:
         key_merge(it->first, p);
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    struct clock_entry_t {
+        value_t value_;
+        // Set on every access and cleared by the CLOCK hand
+        mutable std::atomic<bool> referenced_;
+        clock_entry_t(const value_t &value)
+            : value_(value), referenced_(true) {}
+    };
 
-        if (n == capacity_) {
-            cache_mapper().clear();
-            return;
+    // NOTE: pairs that contain atomics cannot be stored in an unordered_map
+    // *as an element*, since it invokes the copy constructor of std::atomic,
+    // which is deleted.
+    using mapper_t = std::unordered_map<key_t, clock_entry_t>;
+
+    struct shard_t {
+        utils::rw_mutex_t mutex;
+        mapper_t mapper;
+        // Bucket the CLOCK hand points to
+        size_t hand = 0;
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> misses {0};
+
+        value_t get_future(const key_t &key) const {
+            auto it = mapper.find(key);
+            if (it == mapper.end()) return value_t();
+            it->second.referenced_.store(true, std::memory_order_relaxed);
+            return it->second.value_;
         }
 
-        for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                // By default, load() and operator T use sequentially
-                // consistent memory ordering, which enforces writing
-                // the timestamps into registers in the same exact order
-                // they are read from the CPU cache line. Since eviction
-                // is performed under a write lock, this order is not
-                // important, therefore we can safely use the weakest
-                // memory ordering (relaxed). This brings about a few
-                // microseconds performance improvement for default
-                // cache capacity.
-                return left.second.timestamp_.load(std::memory_order_relaxed)
-                        < right.second.timestamp_.load(
-                                std::memory_order_relaxed);
-            });
-            auto res = cache_mapper().erase(it->first);
+        void add(const key_t &key, const value_t &value) {
+            auto res = mapper.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(key), std::forward_as_tuple(value));
             MAYBE_UNUSED(res);
-            assert(res);
+            assert(res.second);
         }
-    }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
-            evict(1);
-        }
-
-        size_t timestamp = get_timestamp();
 
-        auto res = cache_mapper().emplace(std::piecewise_construct,
-                std::forward_as_tuple(key),
-                std::forward_as_tuple(value, timestamp));
-        MAYBE_UNUSED(res);
-        assert(res.second);
-    }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
-
-        size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
-        // Return the entry
-        return it->second.value_;
-    }
+        // Must be called under the write lock. Returns false if the shard is
+        // empty.
+        bool evict_one() {
+            if (mapper.empty()) return false;
+            // After one full sweep all reference bits are cleared, so the
+            // second sweep is guaranteed to find a victim.
+            const size_t nbuckets = mapper.bucket_count();
+            for (size_t step = 0; step <= 2 * nbuckets; step++) {
+                const size_t b = hand % nbuckets;
+                for (auto it = mapper.begin(b); it != mapper.end(b); ++it) {
+                    if (it->second.referenced_.load(
+                                std::memory_order_relaxed)) {
+                        it->second.referenced_.store(
+                                false, std::memory_order_relaxed);
+                        continue;
+                    }
+                    auto res = mapper.erase(it->first);
+                    MAYBE_UNUSED(res);
+                    assert(res);
+                    return true;
+                }
+                hand = b + 1;
+            }
+            assert(!"unreachable");
+            return false;
+        }
 
-    int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        // Leaks cached resources. Used to avoid issues with calling
+        // destructors allocated by an already unloaded dynamic library.
+        void release() {
+            auto t = utils::make_unique<mapper_t>();
+            std::swap(*t, mapper);
+            t.release();
+        }
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
+    shard_t &get_shard(const key_t &key) {
+        // Use the high bits of a multiplicative hash so the shard index is
+        // independent from the bucket index inside of the shard.
+        const uint64_t h = static_cast<uint64_t>(std::hash<key_t>()(key))
+                * 0x9e3779b97f4a7c15ULL;
+        return shards_[h >> 60];
     }
 
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
+    void evict_excess() {
+        // Bound the number of sweeps over the shards in case other threads
+        // keep adding entries concurrently.
+        int n_empty = 0;
+        while (is_over_capacity() && n_empty < num_shards) {
+            auto &shard = shards_[evict_hand_++ % num_shards];
+            utils::lock_write_t lock_w(shard.mutex);
+            if (is_over_capacity() && shard.evict_one()) {
+                size_--;
+                n_empty = 0;
+            } else {
+                n_empty++;
+            }
+        }
     }
 
-    // Leaks cached resources. Used to avoid issues with calling destructors
-    // allocated by an already unloaded dynamic library.
-    void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
+    bool is_over_capacity() const {
+        return size_ > capacity_
+                || (size_ > 0 && is_over_budget_ && is_over_budget_());
     }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+
+    static_assert(num_shards == 16, "get_shard() assumes 16 shards");
+
+    std::atomic<int> capacity_;
+    bool (*const is_over_budget_)();
+    std::atomic<int> size_ {0};
+    std::atomic<unsigned> evict_hand_ {0};
+    std::mutex capacity_mutex_;
+    shard_t shards_[num_shards];
 };
 
 } // namespace utils
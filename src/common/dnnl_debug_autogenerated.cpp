@@ -1931,6 +1931,14 @@ const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     return "unknown scratchpad_mode";
 }
 
+const char *dnnl_store_mode2str(dnnl_store_mode_t v) {
+    if (v == dnnl_store_mode_any) return "any";
+    if (v == dnnl_store_mode_regular) return "regular";
+    if (v == dnnl_store_mode_nontemporal) return "nontemporal";
+    assert(!"unknown store_mode");
+    return "unknown store_mode";
+}
+
 const char *dnnl_rounding_mode2str(dnnl_rounding_mode_t v) {
     if (v == dnnl_rounding_mode_environment) return "environment";
     if (v == dnnl_rounding_mode_stochastic) return "stochastic";
@@ -18,8 +18,11 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include "utils.hpp"
 #include "z_magic.hpp"
@@ -257,6 +260,69 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd_ext
  */
 
+/* load-balance statistics */
+// Statistics of the parallel regions run by a thread. When a thread sets
+// `current()`, each `parallel()` region it starts records the time every
+// worker spends in the region body, so that the imbalance between the workers
+// and the time they wait at the join can be reported. Regions nested in a
+// recorded region are not recorded.
+struct parallel_stats_t {
+    int nregions = 0;
+    // Sums over the recorded regions.
+    double busy_ns = 0; // time spent in the body by all threads
+    double capacity_ns = 0; // region wall time multiplied by nthr
+    double max_busy_ns = 0; // time of the busiest thread
+    double mean_busy_ns = 0; // mean time of a thread
+
+    // Time a thread spent in the body of a region.
+    struct span_t {
+        std::thread::id tid;
+        double begin_ns;
+        double end_ns;
+    };
+    // Spans of all threads of the recorded regions, kept only when
+    // `record_spans` is set, e.g. for tracing.
+    bool record_spans = false;
+    std::vector<span_t> spans;
+
+    void add_region(const std::vector<span_t> &thr_spans, double wall_ns) {
+        const int nthr = static_cast<int>(thr_spans.size());
+        double sum = 0, max = 0;
+        for (const auto &s : thr_spans) {
+            sum += s.end_ns - s.begin_ns;
+            max = std::max(max, s.end_ns - s.begin_ns);
+            if (record_spans && s.tid != std::thread::id()) spans.push_back(s);
+        }
+        nregions++;
+        busy_ns += sum;
+        capacity_ns += nthr * wall_ns;
+        max_busy_ns += max;
+        mean_busy_ns += sum / nthr;
+    }
+
+    // Time of the busiest thread relative to the mean, 1 for perfect balance.
+    double max_to_mean() const {
+        return mean_busy_ns > 0 ? max_busy_ns / mean_busy_ns : 1.;
+    }
+
+    // Fraction of the regions time the threads were not running the body.
+    double idle_ratio() const {
+        return capacity_ns > 0 ? std::max(0., 1. - busy_ns / capacity_ns) : 0.;
+    }
+
+    static parallel_stats_t *&current() {
+        static thread_local parallel_stats_t *stats = nullptr;
+        return stats;
+    }
+
+    static double now_ns() {
+        using namespace std::chrono;
+        return duration<double, std::nano>(
+                steady_clock::now().time_since_epoch())
+                .count();
+    }
+};
+
 /* general parallelization */
 inline int adjust_num_threads(int nthr, dim_t work_amount) {
     if (nthr == 0) nthr = dnnl_get_current_num_threads();
@@ -269,6 +335,26 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 
 static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     nthr = adjust_num_threads(nthr, INT64_MAX);
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    // Threadpools may complete the region asynchronously, so the statistics
+    // are not recorded for them.
+    if (nthr > 1 && parallel_stats_t::current()) {
+        parallel_stats_t *stats = parallel_stats_t::current();
+        parallel_stats_t::current() = nullptr;
+        std::vector<parallel_stats_t::span_t> thr_spans(nthr);
+        const double start_ns = parallel_stats_t::now_ns();
+        parallel(nthr, [&](int ithr, int nthr_) {
+            const double ithr_start_ns = parallel_stats_t::now_ns();
+            f(ithr, nthr_);
+            if (ithr < nthr)
+                thr_spans[ithr] = {std::this_thread::get_id(), ithr_start_ns,
+                        parallel_stats_t::now_ns()};
+        });
+        stats->add_region(thr_spans, parallel_stats_t::now_ns() - start_ns);
+        parallel_stats_t::current() = stats;
+        return;
+    }
+#endif
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
         f(i, nthr);
@@ -24,6 +24,7 @@
 #include "common/stream_impl.hpp"
 #include "engine_id.hpp"
 #include "memory.hpp"
+#include "memory_usage.hpp"
 #include "memory_storage.hpp"
 #include "primitive_desc.hpp"
 #include "utils.hpp"
@@ -76,8 +77,13 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
 
     dnnl::impl::status_t create_memory_storage(
             dnnl::impl::memory_storage_t **storage, size_t size) {
-        return create_memory_storage(
+        auto status = create_memory_storage(
                 storage, dnnl::impl::memory_flags_t::alloc, size, nullptr);
+        // Host allocations are reported by impl::malloc().
+        if (status == dnnl::impl::status::success
+                && kind() != dnnl::impl::engine_kind::cpu)
+            dnnl::impl::memory_usage::on_alloc(size);
+        return status;
     }
 
     /** create stream */
@@ -52,12 +52,22 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
                          & ~(normalization_flags::use_global_stats
                                  | normalization_flags::use_scale
                                  | normalization_flags::use_shift
-                                 | normalization_flags::rms_norm))
+                                 | normalization_flags::rms_norm
+                                 | normalization_flags::use_residual
+                                 | normalization_flags::output_residual))
                     == 0,
             VERBOSE_BAD_FLAGS);
 
     bool is_fwd
             = prop_kind == forward_training || prop_kind == forward_inference;
+    VCHECK_LNORM(IMPLICATION(flags
+                                 & (normalization_flags::use_residual
+                                         | normalization_flags::output_residual),
+                         is_fwd),
+            VERBOSE_BAD_FLAGS);
+    VCHECK_LNORM(IMPLICATION(flags & normalization_flags::output_residual,
+                         flags & normalization_flags::use_residual),
+            VERBOSE_BAD_FLAGS);
     VCHECK_LNORM(IMPLICATION(is_fwd, dst_desc != nullptr), VERBOSE_NULL_ARG);
     VCHECK_LNORM(IMPLICATION(!is_fwd, !any_null(diff_src_desc, diff_dst_desc)),
             VERBOSE_NULL_ARG);
@@ -162,7 +172,9 @@ status_t layer_normalization_attr_check(const layer_normalization_desc_t &desc,
 
         const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
                 || utils::one_of(dst_dt, data_type::s8, data_type::u8);
-        if (is_int8) fwd_attr_mask |= smask_t::scales;
+        const bool is_fp8
+                = utils::one_of(dst_dt, data_type::f8_e5m2, data_type::f8_e4m3);
+        if (is_int8 || is_fp8) fwd_attr_mask |= smask_t::scales;
 
         VCHECK_LNORM_UNIMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
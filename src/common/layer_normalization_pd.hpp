@@ -91,6 +91,12 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool skip_mean() const {
         return desc_.flags & normalization_flags::rms_norm;
     }
+    bool use_residual() const {
+        return desc_.flags & normalization_flags::use_residual;
+    }
+    bool output_residual() const {
+        return desc_.flags & normalization_flags::output_residual;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -184,6 +190,12 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SHIFT)
             return use_shift() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SRC_1)
+            return use_residual() ? arg_usage_t::input : arg_usage_t::unused;
+        if (arg == DNNL_ARG_DST_1)
+            return output_residual() ? arg_usage_t::output
+                                     : arg_usage_t::unused;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -192,6 +204,8 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_SRC_1: return src_md(3);
+            case DNNL_ARG_DST_1: return dst_md(3);
             case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
                 return stats_are_src() ? src_md(2) : dst_md(2);
@@ -205,6 +219,8 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        // The residual shares the memory descriptor of the source.
+        if (use_residual() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -213,6 +229,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
+        if (output_residual() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -223,13 +240,15 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     int n_inputs() const override {
         return 1 + (2 - skip_mean()) * stats_are_src() + use_scale()
-                + use_shift() + n_binary_po_inputs();
+                + use_shift() + use_residual() + n_binary_po_inputs();
     }
     int n_outputs() const override {
         // Originally as '1 + 2 * (!stats_are_src()) * is_training()',
         // had to be worked around MSVC bug not copying inlined bodies
         // of stats_are_src() and is_training().
-        return (!stats_are_src() && is_training()) ? 3 - skip_mean() : 1;
+        const int n_stats
+                = (!stats_are_src() && is_training()) ? 2 - skip_mean() : 0;
+        return 1 + n_stats + output_residual();
     }
 
 protected:
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <sstream>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_usage.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace memory_usage {
+
+namespace {
+
+// Engine kinds are used as indices, the `any_engine` counters hold the sum
+// over the engine kinds.
+constexpr int n_engine_kinds = engine_kind::gpu + 1;
+constexpr int n_kinds = static_cast<int>(kind_t::total) + 1;
+
+struct counter_t {
+    std::atomic<size_t> cur {0};
+    std::atomic<size_t> peak {0};
+
+    void add(size_t size) {
+        const size_t val
+                = cur.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t prev_peak = peak.load(std::memory_order_relaxed);
+        while (val > prev_peak
+                && !peak.compare_exchange_weak(
+                        prev_peak, val, std::memory_order_relaxed)) {}
+    }
+
+    void sub(size_t size) { cur.fetch_sub(size, std::memory_order_relaxed); }
+};
+
+counter_t counters[n_kinds][n_engine_kinds];
+std::atomic<size_t> budget_bytes {0};
+thread_local scope_t *active_scope = nullptr;
+
+bool is_valid(kind_t kind, engine_kind_t engine_kind) {
+    const int k = static_cast<int>(kind);
+    return k >= 0 && k < n_kinds && engine_kind >= 0
+            && engine_kind < n_engine_kinds;
+}
+
+counter_t &counter(kind_t kind, engine_kind_t engine_kind) {
+    return counters[static_cast<int>(kind)][engine_kind];
+}
+
+} // namespace
+
+void add(kind_t kind, engine_kind_t engine_kind, size_t size) {
+    if (size == 0) return;
+    assert(kind != kind_t::total && engine_kind != engine_kind::any_engine);
+    if (!is_valid(kind, engine_kind)) return;
+    counter(kind, engine_kind).add(size);
+    counter(kind, engine_kind::any_engine).add(size);
+    counter(kind_t::total, engine_kind).add(size);
+    counter(kind_t::total, engine_kind::any_engine).add(size);
+}
+
+void sub(kind_t kind, engine_kind_t engine_kind, size_t size) {
+    if (size == 0) return;
+    assert(kind != kind_t::total && engine_kind != engine_kind::any_engine);
+    if (!is_valid(kind, engine_kind)) return;
+    counter(kind, engine_kind).sub(size);
+    counter(kind, engine_kind::any_engine).sub(size);
+    counter(kind_t::total, engine_kind).sub(size);
+    counter(kind_t::total, engine_kind::any_engine).sub(size);
+}
+
+size_t get(kind_t kind, engine_kind_t engine_kind) {
+    if (!is_valid(kind, engine_kind)) return 0;
+    return counter(kind, engine_kind).cur.load(std::memory_order_relaxed);
+}
+
+size_t get_peak(kind_t kind, engine_kind_t engine_kind) {
+    if (!is_valid(kind, engine_kind)) return 0;
+    return counter(kind, engine_kind).peak.load(std::memory_order_relaxed);
+}
+
+void set_budget(size_t budget) {
+    budget_bytes.store(budget, std::memory_order_relaxed);
+}
+
+size_t get_budget() {
+    return budget_bytes.load(std::memory_order_relaxed);
+}
+
+size_t budget_excess(size_t size) {
+    const size_t budget = get_budget();
+    if (budget == 0) return 0;
+    const size_t total = get(kind_t::total, engine_kind::any_engine) + size;
+    return total > budget ? total - budget : 0;
+}
+
+scope_t::scope_t() : prev_(active_scope) {
+    active_scope = this;
+}
+
+scope_t::~scope_t() {
+    active_scope = prev_;
+}
+
+void on_alloc(size_t size) {
+    if (active_scope) active_scope->bytes_ += size;
+}
+
+std::string summary(engine_kind_t engine_kind) {
+    std::ostringstream ss;
+    ss << "primitives:" << get(kind_t::primitives, engine_kind)
+       << ",scratchpad:" << get(kind_t::scratchpad, engine_kind)
+       << ",jit_code:" << get(kind_t::jit_code, engine_kind)
+       << ",constant_cache:" << get(kind_t::constant_cache, engine_kind)
+       << ",total:" << get(kind_t::total, engine_kind::any_engine)
+       << ",peak:" << get_peak(kind_t::total, engine_kind::any_engine);
+    return ss.str();
+}
+
+} // namespace memory_usage
+} // namespace impl
+} // namespace dnnl
+
+dnnl::impl::status_t dnnl_get_memory_usage(dnnl_memory_usage_kind_t kind,
+        dnnl_engine_kind_t engine_kind, size_t *bytes, size_t *peak_bytes) {
+    using namespace dnnl::impl;
+    const auto k = static_cast<memory_usage::kind_t>(kind);
+    if (!memory_usage::is_valid(k, engine_kind))
+        return status::invalid_arguments;
+    if (bytes) *bytes = memory_usage::get(k, engine_kind);
+    if (peak_bytes) *peak_bytes = memory_usage::get_peak(k, engine_kind);
+    return status::success;
+}
+
+dnnl::impl::status_t dnnl_set_memory_budget(size_t bytes) {
+    dnnl::impl::memory_usage::set_budget(bytes);
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_memory_budget(size_t *bytes) {
+    if (bytes == nullptr) return dnnl::impl::status::invalid_arguments;
+    *bytes = dnnl::impl::memory_usage::get_budget();
+    return dnnl::impl::status::success;
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_MEMORY_USAGE_HPP
+#define COMMON_MEMORY_USAGE_HPP
+
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Accounting of the memory held by the library.
+//
+// The memory is accounted per category and per engine kind, along with the
+// high-water marks. The categories do not overlap, so their sum is the total
+// memory the library holds:
+// - primitives: memory allocated by primitives at creation, such as packed
+//   weights and lookup tables, and by their resources. It includes the
+//   primitives held by the primitive and compiled partition caches.
+// - scratchpad: library-managed scratchpads, including the global ones.
+// - jit_code: code of CPU JIT kernels.
+// - constant_cache: buffers of the graph constant tensor cache.
+//
+// A budget may be set on the total memory. It is enforced by the primitive
+// and constant tensor caches, which evict entries when an insertion happens
+// while the total is over the budget.
+namespace memory_usage {
+
+enum class kind_t : int {
+    primitives = dnnl_memory_usage_primitives,
+    scratchpad = dnnl_memory_usage_scratchpad,
+    jit_code = dnnl_memory_usage_jit_code,
+    constant_cache = dnnl_memory_usage_constant_cache,
+    total = dnnl_memory_usage_total,
+};
+
+void add(kind_t kind, engine_kind_t engine_kind, size_t size);
+void sub(kind_t kind, engine_kind_t engine_kind, size_t size);
+
+// `kind_t::total` and `engine_kind::any_engine` query the sum over the
+// categories and engine kinds respectively.
+size_t get(kind_t kind, engine_kind_t engine_kind);
+size_t get_peak(kind_t kind, engine_kind_t engine_kind);
+
+// A budget of 0 stands for no budget.
+void set_budget(size_t budget);
+size_t get_budget();
+
+// Returns the number of bytes by which the total memory would exceed the
+// budget after allocating `size` more bytes.
+size_t budget_excess(size_t size = 0);
+
+// Counts the memory allocated by the library on the current thread while the
+// object is alive. It is used to attribute the allocations made during
+// a primitive creation to the primitive. Scopes do not propagate: the bytes
+// counted by an inner scope are not added to the outer one, so a nested
+// primitive is accounted for once.
+struct scope_t {
+    scope_t();
+    ~scope_t();
+
+    size_t bytes() const { return bytes_; }
+
+private:
+    friend void on_alloc(size_t size);
+
+    size_t bytes_ = 0;
+    scope_t *prev_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+};
+
+// Reports an allocation to the active scope, if any. Called for host
+// allocations made with impl::malloc() and for device memory storages.
+void on_alloc(size_t size);
+
+// Returns a string with the current memory per category for `engine_kind`
+// and the total for all engines, e.g., for verbose.
+std::string summary(engine_kind_t engine_kind);
+
+} // namespace memory_usage
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -20,6 +20,7 @@
 #include "common/c_types_map.hpp"
 #include "common/cache_blob.hpp"
 #include "common/cache_hit_types.hpp"
+#include "common/memory_usage.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_exec_types.hpp"
 
@@ -35,7 +36,10 @@ struct primitive_t : public c_compatible {
     using primitive_list_t = std::vector<const primitive_t *>;
 
     primitive_t(const primitive_desc_t *pd) : pd_(pd->clone()) {}
-    virtual ~primitive_t() = default;
+    virtual ~primitive_t() {
+        memory_usage::sub(memory_usage::kind_t::primitives,
+                footprint_engine_kind_, footprint_);
+    }
 
     virtual status_t init(impl::engine_t *engine) { return status::success; }
 
@@ -75,6 +79,10 @@ struct primitive_t : public c_compatible {
         return creation_cached_state_;
     }
 
+    // Returns the memory allocated during the primitive creation, not
+    // including nested primitives which are accounted separately.
+    size_t footprint() const { return footprint_; }
+
 protected:
     template <typename impl_type, typename pd_t>
     static status_t create_primitive_common(
@@ -102,8 +110,11 @@ protected:
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
+            memory_usage::scope_t scope;
             status_t status
                     = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
+            if (status == status::success)
+                p->set_footprint(c.engine->kind(), scope.bytes());
             c.cache_status = p->creation_cache_state();
             return primitive_cache_iface_t::result_t {std::move(p), status};
         };
@@ -119,6 +130,15 @@ protected:
     cache_state_t creation_cached_state_ = cache_state_t::miss;
 
 private:
+    void set_footprint(engine_kind_t engine_kind, size_t size) {
+        footprint_engine_kind_ = engine_kind;
+        footprint_ = size;
+        memory_usage::add(memory_usage::kind_t::primitives, engine_kind, size);
+    }
+
+    size_t footprint_ = 0;
+    engine_kind_t footprint_engine_kind_ = engine_kind::any_engine;
+
     primitive_t() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_t);
 };
@@ -469,6 +469,15 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_store_mode(store_mode_t store_mode) {
+    const bool ok = one_of(store_mode, store_mode::any, store_mode::regular,
+            store_mode::nontemporal);
+    if (!ok) return invalid_arguments;
+
+    store_mode_ = store_mode;
+    return success;
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     post_ops_ = post_ops;
     return status::success;
@@ -612,6 +621,22 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_store_mode(
+        const primitive_attr_t *attr, store_mode_t *store_mode) {
+    if (any_null(attr, store_mode)) return invalid_arguments;
+
+    *store_mode = attr->store_mode_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_store_mode(
+        primitive_attr_t *attr, store_mode_t store_mode) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->set_store_mode(store_mode);
+}
+
 status_t dnnl_primitive_attr_set_scales_mask(
         primitive_attr_t *attr, int arg, int mask) {
     VCHECK_ATTR(attr, VERBOSE_NULL_ARG);
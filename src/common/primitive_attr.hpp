@@ -552,6 +552,7 @@ private:
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
+        , store_mode_(dnnl::impl::store_mode::any)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
         , deterministic_(false) {}
@@ -576,6 +577,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         precomputed_reductions_ = other.precomputed_reductions_;
         rounding_mode_ = other.rounding_mode_;
         scratchpad_mode_ = other.scratchpad_mode_;
+        store_mode_ = other.store_mode_;
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
@@ -651,7 +653,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_ and store_mode_ are not take into account */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -660,6 +662,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
+                && store_mode_ == rhs.store_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
@@ -688,6 +691,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             bool use_host_scalars);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_store_mode(dnnl::impl::store_mode_t store_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
     dnnl::impl::status_t set_gpu_attr(
             const dnnl::impl::primitive_attr_item_t &gpu_attr);
@@ -743,6 +747,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::precomputed_reductions_t precomputed_reductions_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
+    dnnl::impl::store_mode_t store_mode_;
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
@@ -18,6 +18,7 @@
 #include "c_types_map.hpp"
 #include "cache_utils.hpp"
 #include "kernel_cache.hpp"
+#include "memory_usage.hpp"
 #include "primitive.hpp"
 #include "primitive_cache_test_api.hpp"
 #include "primitive_desc_iface.hpp"
@@ -27,13 +28,13 @@
 namespace dnnl {
 namespace impl {
 
-// The cache uses LRU replacement policy
+// The cache uses CLOCK (approximate LRU) replacement policy
 struct primitive_cache_t {
     using key_t = primitive_hashing::key_t;
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity) : cache_(capacity, is_over_budget) {};
 
     ~primitive_cache_t() = default;
 
@@ -43,6 +44,13 @@ struct primitive_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    static constexpr int get_num_shards() { return cache_t::num_shards; }
+    void get_shard_stats(int shard, uint64_t *hits, uint64_t *misses) const {
+        const auto stats = cache_.get_shard_stats(shard);
+        *hits = stats.hits;
+        *misses = stats.misses;
+    }
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
         return result.value != nullptr ? result.value->pd() : nullptr;
@@ -54,6 +62,8 @@ struct primitive_cache_t {
     }
 
 private:
+    static bool is_over_budget() { return memory_usage::budget_excess() > 0; }
+
     static void update_key(const key_t &key, const primitive_t &p) {
         const primitive_desc_t *pd = p.pd().get();
         key.op_desc_ = pd->op_desc();
@@ -66,7 +76,9 @@ private:
         cache_.set_capacity_without_clearing(capacity);
     }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    using cache_t
+            = utils::lru_cache_t<key_t, primitive_t, result_t, update_key>;
+    cache_t cache_;
 };
 
 primitive_cache_t &global_primitive_cache() {
@@ -146,6 +158,22 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
 
+dnnl::impl::status_t dnnl_get_primitive_cache_num_shards(int *num_shards) {
+    if (num_shards == nullptr) return dnnl::impl::status::invalid_arguments;
+    *num_shards = dnnl::impl::primitive_cache_t::get_num_shards();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_shard_stats(
+        int shard, uint64_t *hits, uint64_t *misses) {
+    using namespace dnnl::impl;
+    if (hits == nullptr || misses == nullptr) return status::invalid_arguments;
+    if (shard < 0 || shard >= primitive_cache_t::get_num_shards())
+        return status::invalid_arguments;
+    global_primitive_cache().get_shard_stats(shard, hits, misses);
+    return status::success;
+}
+
 // Undocumented API declared in primitive_cache_test_api.hpp
 using namespace dnnl;
 using namespace dnnl::impl;
@@ -224,6 +224,8 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     size_t seed = 0;
     // scratchpad_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
+    // store_mode
+    seed = hash_combine(seed, static_cast<size_t>(attr.store_mode_));
     // fpmath_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.mode_));
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
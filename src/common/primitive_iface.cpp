@@ -14,8 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <string>
 
+#include "oneapi/dnnl/dnnl_debug.h"
+
 #include "c_types_map.hpp"
 #include "engine.hpp"
 
@@ -24,6 +27,8 @@
 #endif
 
 #include "cache_hit_types.hpp"
+#include "dnnl_thread.hpp"
+#include "memory_usage.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
@@ -33,8 +38,13 @@
 #include "scratchpad_debug.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/perf_counters.hpp"
+#endif
+
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::primitive_kind;
@@ -56,6 +66,11 @@ void unpoison_outputs(const exec_args_t &args) {
 }
 } // namespace
 
+namespace {
+std::atomic<bool> parallel_stats_requested {false};
+thread_local parallel_stats_t last_parallel_stats;
+} // namespace
+
 namespace dnnl {
 namespace impl {
 
@@ -73,6 +88,7 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
     }
 #endif
 
+    const double trace_start_us = trace::is_enabled() ? trace::now_us() : 0.;
     if (get_verbose(verbose_t::create_profile,
                 prim_kind2_comp_kind(primitive_desc_iface->impl()->kind()))) {
         double start_ms = get_msec();
@@ -88,11 +104,27 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
 
         VPROF(start_ms, primitive, create, str, p_iface.first->pd()->info(),
                 duration_ms);
+        if (get_verbose(verbose_t::create_memory,
+                    prim_kind2_comp_kind(
+                            primitive_desc_iface->impl()->kind())))
+            VFORMAT(start_ms, verbose_t::create_memory, primitive, create,
+                    VERBOSE_memory, "%s,footprint:%zu,%s",
+                    p_iface.first->pd()->info(), p_iface.first->footprint(),
+                    memory_usage::summary(
+                            primitive_desc_iface->engine()->kind())
+                            .c_str());
     } else {
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
     }
 
+    if (trace::is_enabled())
+        trace::add_span("primitive_create",
+                dnnl_prim_kind2str(primitive_desc_iface->impl()->kind()),
+                trace_start_us, trace::now_us(),
+                std::string(cache_state2str(p_iface.second)) + ","
+                        + p_iface.first->pd()->info());
+
 #if defined(DNNL_ENABLE_ITT_TASKS)
     if (enable_itt) {
         // Before metadata is added to the ITT task, the `info()` string is
@@ -145,6 +177,20 @@ status_t primitive_execute(
     }
 #endif
 
+    // Load-balance statistics are collected for the parallel regions run on
+    // the calling thread, regions run by the workers of out-of-order streams
+    // are not accounted for.
+    const bool with_trace = trace::is_enabled();
+    const bool with_parallel_stats = with_trace
+            || get_verbose(verbose_t::exec_imbalance,
+                    prim_kind2_comp_kind(pd->impl()->kind()))
+            || parallel_stats_requested.load(std::memory_order_relaxed);
+    parallel_stats_t parallel_stats;
+    parallel_stats.record_spans = with_trace;
+    parallel_stats_t *prev_parallel_stats = parallel_stats_t::current();
+    if (with_parallel_stats) parallel_stats_t::current() = &parallel_stats;
+    const double trace_start_us = with_trace ? trace::now_us() : 0.;
+
     if (get_verbose(verbose_t::exec_profile,
                 prim_kind2_comp_kind(pd->impl()->kind()))) {
         bool block_on_wait = true;
@@ -157,13 +203,29 @@ status_t primitive_execute(
                                 ASYNCHRONOUS)
                 && stream->engine()->kind() == engine_kind::cpu;
         block_on_wait = !is_async_cpu;
+#endif
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        const bool with_counters = block_on_wait
+                && stream->engine()->kind() == engine_kind::cpu
+                && get_verbose(verbose_t::exec_counters,
+                        prim_kind2_comp_kind(pd->impl()->kind()));
+        cpu::perf_counters::sample_t counters_begin, counters_end;
+        if (with_counters) cpu::perf_counters::attach_threads();
 #endif
         if (block_on_wait) stream->wait();
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        if (with_counters) cpu::perf_counters::read(counters_begin);
+#endif
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         if (block_on_wait) stream->wait();
 
         double duration_ms = get_msec() - start_ms;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        if (with_counters) cpu::perf_counters::read(counters_end);
+#endif
+        std::string rt_info;
+        const char *info = pd->info();
         if (pd->impl()->has_runtime_dims_or_strides()) {
             // Take out mds from `ctx` here to avoid primitive_desc dependency
             // on `exec_ctx_t` type.
@@ -177,18 +239,47 @@ status_t primitive_execute(
             const auto pd_dst_md = pd->impl()->invariant_dst_md();
             const auto dst_md = ctx.memory_mdw(DNNL_ARG_DST, pd_dst_md).md_;
 
-            std::string info = pd->info_with_runtime_dims(
+            rt_info = pd->info_with_runtime_dims(
                     src_md, wei_md, bia_md, dst_md);
-            VPROF(start_ms, primitive, exec, VERBOSE_profile, info.c_str(),
-                    duration_ms);
-        } else {
-            VPROF(start_ms, primitive, exec, VERBOSE_profile, pd->info(),
-                    duration_ms);
+            info = rt_info.c_str();
         }
+        VPROF(start_ms, primitive, exec, VERBOSE_profile, info, duration_ms);
+        if (with_parallel_stats && parallel_stats.nregions > 0
+                && get_verbose(verbose_t::exec_imbalance,
+                        prim_kind2_comp_kind(pd->impl()->kind())))
+            VFORMAT(start_ms, verbose_t::exec_imbalance, primitive, exec,
+                    VERBOSE_imbalance, "%s,nregions:%d,max_mean:%g,idle:%g",
+                    info, parallel_stats.nregions,
+                    parallel_stats.max_to_mean(),
+                    parallel_stats.idle_ratio());
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        if (with_counters)
+            VFORMAT(start_ms, verbose_t::exec_counters, primitive, exec,
+                    VERBOSE_counters, "%s,%s", info,
+                    cpu::perf_counters::to_string(
+                            counters_begin, counters_end, duration_ms)
+                            .c_str());
+#endif
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
 
+    if (with_trace) {
+        trace::add_span("primitive_exec",
+                dnnl_prim_kind2str(pd->impl()->kind()), trace_start_us,
+                trace::now_us(), pd->info());
+        for (const auto &span : parallel_stats.spans)
+            trace::add_span("parallel", "parallel", span.begin_ns * 1e-3,
+                    span.end_ns * 1e-3, std::string(),
+                    trace::get_tid(span.tid));
+        parallel_stats.spans.clear();
+    }
+
+    if (with_parallel_stats) {
+        parallel_stats_t::current() = prev_parallel_stats;
+        last_parallel_stats = parallel_stats;
+    }
+
 #if defined(DNNL_ENABLE_ITT_TASKS)
     if (enable_itt) itt::primitive_task_end(VERBOSE_exec);
 #endif
@@ -299,6 +390,23 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
     return primitive_iface->get_cache_blob(cb);
 }
 
+// Internal API to collect load-balance statistics of parallel regions without
+// enabling the verbose mode.
+extern "C" status_t DNNL_API dnnl_impl_set_parallel_stats(int enable) {
+    parallel_stats_requested.store(enable != 0, std::memory_order_relaxed);
+    return success;
+}
+
+// Returns the statistics of the latest primitive execution on the calling
+// thread that collected them. Any output pointer may be null.
+extern "C" status_t DNNL_API dnnl_impl_query_parallel_stats(
+        int *nregions, double *max_to_mean, double *idle_ratio) {
+    if (nregions) *nregions = last_parallel_stats.nregions;
+    if (max_to_mean) *max_to_mean = last_parallel_stats.max_to_mean();
+    if (idle_ratio) *idle_ratio = last_parallel_stats.idle_ratio();
+    return success;
+}
+
 status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     if (primitive_iface != nullptr) primitive_iface->release();
     return success;
@@ -321,6 +429,8 @@ dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_t> &primitive,
               primitive_->pd(), engine, src_engine, dst_engine)) {}
 
 dnnl_primitive::~dnnl_primitive() {
+    memory_usage::sub(memory_usage::kind_t::primitives, engine()->kind(),
+            resource_footprint_);
     if (scratchpad_debug::is_protect_scratchpad() && scratchpad_ != nullptr
             && scratchpad_->get_memory_storage() != nullptr) {
         const memory_tracking::registry_t &registry
@@ -355,7 +465,17 @@ status_t dnnl_primitive::init() {
         scratchpad_.reset(scratchpad_ptr);
         if (scratchpad_ptr->size() < scratchpad_size) return out_of_memory;
     }
-    return primitive_->create_resource(pd()->engine(), resource_mapper_);
+
+    memory_usage::scope_t scope;
+    CHECK(primitive_->create_resource(pd()->engine(), resource_mapper_));
+    resource_footprint_ = scope.bytes();
+    memory_usage::add(memory_usage::kind_t::primitives, engine()->kind(),
+            resource_footprint_);
+    return success;
+}
+
+size_t dnnl_primitive::footprint() const {
+    return primitive_->footprint() + resource_footprint_;
 }
 
 engine_t *dnnl_primitive::engine() const {
@@ -65,6 +65,9 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Returns the memory allocated at creation by the primitive and its
+    // resources.
+    size_t footprint() const;
 
     void retain() { counter_++; }
 
@@ -81,6 +84,7 @@ private:
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    size_t resource_footprint_ = 0;
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
@@ -179,6 +179,8 @@ void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops) {
 void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     // scratchpad_mode
     sstream.append(attr.scratchpad_mode_);
+    // store_mode
+    sstream.append(attr.store_mode_);
     // fpmath_mode
     sstream.append(attr.fpmath_.mode_);
     sstream.append(attr.fpmath_.apply_to_int_);
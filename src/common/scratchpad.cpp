@@ -17,6 +17,8 @@
 #include <memory>
 
 #include "engine.hpp"
+#include "memory_usage.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -52,9 +54,13 @@ memory_storage_t *create_scratchpad_memory_storage(
     mem_engine = engine;
 #endif
 
+    const double trace_start_us = trace::is_enabled() ? trace::now_us() : 0.;
     memory_storage_t *mem_storage = nullptr;
     auto status = mem_engine->create_memory_storage(&mem_storage, size);
     MAYBE_UNUSED(status);
+    if (trace::is_enabled())
+        trace::add_span("scratchpad", "scratchpad_alloc", trace_start_us,
+                trace::now_us(), "size:" + std::to_string(size));
     return mem_storage;
 }
 
@@ -65,11 +71,19 @@ memory_storage_t *create_scratchpad_memory_storage(
   a concurrent execution
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
-    concurrent_scratchpad_t(engine_t *engine, size_t size) : size_(size) {
+    concurrent_scratchpad_t(engine_t *engine, size_t size)
+        : size_(size), engine_kind_(engine->kind()) {
         auto *mem_storage = create_scratchpad_memory_storage(engine, size);
         if (mem_storage == nullptr) size_ = 0;
 
         mem_storage_.reset(mem_storage);
+        memory_usage::add(
+                memory_usage::kind_t::scratchpad, engine_kind_, size_);
+    }
+
+    ~concurrent_scratchpad_t() override {
+        memory_usage::sub(
+                memory_usage::kind_t::scratchpad, engine_kind_, size_);
     }
 
     const memory_storage_t *get_memory_storage() const override {
@@ -81,6 +95,7 @@ struct concurrent_scratchpad_t : public scratchpad_t {
 private:
     std::unique_ptr<memory_storage_t> mem_storage_;
     size_t size_;
+    engine_kind_t engine_kind_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(concurrent_scratchpad_t);
 };
@@ -94,6 +109,8 @@ struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         // TODO: check if engine is the same
         if (size > size_) {
+            memory_usage::sub(
+                    memory_usage::kind_t::scratchpad, engine_kind::cpu, size_);
             delete mem_storage_;
             // Try to expand the global scratchpad to the necessary size
             mem_storage_ = create_scratchpad_memory_storage(engine, size);
@@ -103,6 +120,8 @@ struct global_scratchpad_t : public scratchpad_t {
                 if (mem_storage_ == nullptr) size_ = 0;
             } else
                 size_ = size;
+            memory_usage::add(
+                    memory_usage::kind_t::scratchpad, engine_kind::cpu, size_);
         }
         reference_count_++;
     }
@@ -110,6 +129,8 @@ struct global_scratchpad_t : public scratchpad_t {
     ~global_scratchpad_t() override {
         reference_count_--;
         if (reference_count_ == 0) {
+            memory_usage::sub(
+                    memory_usage::kind_t::scratchpad, engine_kind::cpu, size_);
             delete mem_storage_;
             mem_storage_ = nullptr;
             size_ = 0;
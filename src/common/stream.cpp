@@ -16,6 +16,11 @@
 
 #include <assert.h>
 #include <memory>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -28,6 +33,10 @@
 
 #include "common/stream_impl.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/cpu_stream.hpp"
+#endif
+
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::utils;
@@ -44,14 +53,46 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
+    // CPU profiling relies on synchronous execution or on the library-owned
+    // workers of out-of-order streams.
     if (engine->kind() != engine_kind::gpu
             && (flags & stream_flags::profiling)) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         return status::unimplemented;
+#else
+        if (!is_native_runtime(engine->runtime_kind()))
+            return status::unimplemented;
+#endif
     }
 
     return engine->create_stream(stream, flags);
 }
 
+status_t dnnl_stream_create_with_cpu_affinity(stream_t **stream,
+        engine_t *engine, unsigned flags, int ncores, const int *cores) {
+    bool args_ok = !utils::any_null(stream, engine, cores) && ncores > 0;
+    if (!args_ok) return invalid_arguments;
+
+#if defined(__linux__) && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_TBB
+    if (engine->kind() != engine_kind::cpu
+            || !is_native_runtime(engine->runtime_kind()))
+        return status::unimplemented;
+
+    std::vector<int> cpu_cores(cores, cores + ncores);
+    for (int core : cpu_cores) {
+        if (core < 0 || core >= CPU_SETSIZE) return invalid_arguments;
+    }
+
+    auto stream_impl = utils::make_unique<stream_impl_t>(flags);
+    return safe_ptr_assign(*stream,
+            new cpu::cpu_stream_t(engine, stream_impl.release(), cpu_cores));
+#else
+    return status::unimplemented;
+#endif
+}
+
 status_t dnnl_stream_get_engine(const stream_t *stream, engine_t **engine) {
     if (any_null(stream, engine)) return invalid_arguments;
     *engine = stream->engine();
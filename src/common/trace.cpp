@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/trace.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+namespace {
+
+// Number of latest events kept per thread
+constexpr size_t buffer_capacity = 1 << 16;
+
+struct event_t {
+    const char *cat;
+    std::string name;
+    // Chrome trace event phase: 'X' for complete events, 'i' for instant ones
+    char ph;
+    double ts_us;
+    double dur_us;
+    uint64_t tid;
+    std::string info;
+};
+
+// Written by the owning thread only. The lock is uncontended except when the
+// buffers are flushed.
+struct buffer_t {
+    void add(event_t &&e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (events.size() < buffer_capacity)
+            events.push_back(std::move(e));
+        else
+            events[head % buffer_capacity] = std::move(e);
+        head++;
+    }
+
+    std::mutex mutex;
+    std::vector<event_t> events;
+    size_t head = 0;
+};
+
+void write_escaped(FILE *f, const std::string &s) {
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            fprintf(f, "\\%c", c);
+        else if (static_cast<unsigned char>(c) < 0x20)
+            fprintf(f, "\\u%04x", c);
+        else
+            fputc(c, f);
+    }
+}
+
+struct tracer_t {
+    static tracer_t &get() {
+        // Never destroyed, threads may record events while the static
+        // objects are destroyed.
+        static tracer_t *tracer = new tracer_t();
+        return *tracer;
+    }
+
+    buffer_t &thread_buffer() {
+        // Buffers are owned by the tracer rather than by the threads to keep
+        // the events of the exited threads, see also the caveat about
+        // thread-local objects in scratchpad.cpp.
+        static thread_local buffer_t *buffer = nullptr;
+        if (!buffer) {
+            buffer = new buffer_t();
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffers_.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    uint64_t get_tid(const std::thread::id &id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = tids_.find(id);
+        if (it == tids_.end())
+            it = tids_.emplace(id, static_cast<uint64_t>(tids_.size() + 1))
+                         .first;
+        return it->second;
+    }
+
+    void flush() {
+        FILE *f = fopen(path_.c_str(), "w");
+        if (!f) return;
+        fprintf(f, "{\"traceEvents\":[");
+        const char *delim = "\n";
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto *buffer : buffers_) {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            const size_t n = buffer->events.size();
+            // Oldest events first
+            for (size_t i = 0; i < n; i++) {
+                const auto &e = buffer->events[(buffer->head + i) % n];
+                fprintf(f, "%s{\"name\":\"", delim);
+                write_escaped(f, e.name);
+                fprintf(f, "\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f", e.cat,
+                        e.ph, e.ts_us);
+                if (e.ph == 'X') fprintf(f, ",\"dur\":%.3f", e.dur_us);
+                if (e.ph == 'i') fprintf(f, ",\"s\":\"t\"");
+                fprintf(f, ",\"pid\":0,\"tid\":%llu",
+                        static_cast<unsigned long long>(e.tid));
+                if (!e.info.empty()) {
+                    fprintf(f, ",\"args\":{\"info\":\"");
+                    write_escaped(f, e.info);
+                    fprintf(f, "\"}");
+                }
+                fprintf(f, "}");
+                delim = ",\n";
+            }
+        }
+        fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        fclose(f);
+    }
+
+    const std::string &path() const { return path_; }
+
+private:
+    tracer_t() : path_(getenv_string_user("TRACE_FILE")) {
+        if (!path_.empty()) std::atexit([]() { tracer_t::get().flush(); });
+    }
+
+    std::string path_;
+    std::mutex mutex_;
+    std::vector<buffer_t *> buffers_;
+    std::unordered_map<std::thread::id, uint64_t> tids_;
+};
+
+} // namespace
+
+bool is_enabled() {
+    static const bool enabled = !tracer_t::get().path().empty();
+    return enabled;
+}
+
+double now_us() {
+    using namespace std::chrono;
+    return duration<double, std::micro>(steady_clock::now().time_since_epoch())
+            .count();
+}
+
+uint64_t get_tid(const std::thread::id &id) {
+    return tracer_t::get().get_tid(id);
+}
+
+void add_span(const char *cat, const std::string &name, double start_us,
+        double end_us, const std::string &info, uint64_t tid) {
+    if (!is_enabled()) return;
+    tracer_t::get().thread_buffer().add(
+            {cat, name, 'X', start_us, end_us - start_us, tid, info});
+}
+
+void add_instant(
+        const char *cat, const std::string &name, const std::string &info) {
+    if (!is_enabled()) return;
+    tracer_t::get().thread_buffer().add(
+            {cat, name, 'i', now_us(), 0., get_tid(), info});
+}
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
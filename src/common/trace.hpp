@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TRACE_HPP
+#define COMMON_TRACE_HPP
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace dnnl {
+namespace impl {
+
+// Timeline of the library activity in the Chrome trace event format, which can
+// be opened with chrome://tracing or https://ui.perfetto.dev.
+//
+// Tracing is enabled by setting ONEDNN_TRACE_FILE to the path of the output
+// file. Each thread records its events to its own ring buffer, which keeps the
+// latest events only, and the buffers are written to the file at exit.
+namespace trace {
+
+bool is_enabled();
+
+// Timestamp in microseconds, the clock is the one of
+// `parallel_stats_t::now_ns()`.
+double now_us();
+
+// Identifier of a thread in the trace.
+uint64_t get_tid(const std::thread::id &id = std::this_thread::get_id());
+
+// Records an event that lasts from `start_us` to `end_us` on the thread `tid`.
+// `info` is attached to the event as an argument.
+void add_span(const char *cat, const std::string &name, double start_us,
+        double end_us, const std::string &info = std::string(),
+        uint64_t tid = get_tid());
+
+// Records an event that happens now on the calling thread.
+void add_instant(const char *cat, const std::string &name,
+        const std::string &info = std::string());
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -40,6 +40,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "memory_debug.hpp"
+#include "memory_usage.hpp"
 #include "utils.hpp"
 #include "verbose.hpp"
 
@@ -198,7 +199,9 @@ void *malloc(size_t size, int alignment) {
     int rc = ::posix_memalign(&ptr, alignment, size);
 #endif
 
-    return (rc == 0) ? ptr : nullptr;
+    if (rc != 0) return nullptr;
+    memory_usage::on_alloc(size);
+    return ptr;
 }
 
 void free(void *p) {
@@ -201,6 +201,12 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 k |= verbose_t::create_profile | verbose_t::exec_profile;
             if (s == "profile_create") k |= verbose_t::create_profile;
             if (s == "profile_exec") k |= verbose_t::exec_profile;
+            if (s == "profile_imbalance")
+                k |= verbose_t::exec_profile | verbose_t::exec_imbalance;
+            if (s == "profile_counters")
+                k |= verbose_t::exec_profile | verbose_t::exec_counters;
+            if (s == "profile_memory")
+                k |= verbose_t::create_profile | verbose_t::create_memory;
             // Enable profiling to external libraries
             if (s == "profile_externals") k |= verbose_t::profile_externals;
             if (s == "warn") k |= verbose_t::warn;
@@ -370,6 +376,8 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
     if (flags & normalization_flags::rms_norm) s += "M";
+    if (flags & normalization_flags::use_residual) s += "S";
+    if (flags & normalization_flags::output_residual) s += "O";
     return s;
 }
 
@@ -699,13 +707,17 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
 
     std::string empty_delim, attr_delim = "+";
 
-    // scratchpad and fpmath mode are not a part of
+    // scratchpad, store and fpmath mode are not a part of
     // has_default_values(). Check them first.
     const scratchpad_mode_t &spm = attr->scratchpad_mode_;
     if (spm != scratchpad_mode_t::dnnl_scratchpad_mode_library) {
         ss << field_delim()
            << "attr-scratchpad:" << dnnl_scratchpad_mode2str(spm);
     }
+    const store_mode_t &stm = attr->store_mode_;
+    if (stm != store_mode::any) {
+        ss << field_delim() << "attr-store-mode:" << dnnl_store_mode2str(stm);
+    }
     const fpmath_t &fpm = attr->fpmath_;
     if (fpm.mode_ != fpmath_mode_t::dnnl_fpmath_mode_strict
             || fpm.apply_to_int_) {
@@ -202,6 +202,9 @@ struct verbose_t {
         exec_profile = 1 << 7,
         profile_externals = 1 << 8,
         warn = 1 << 9,
+        exec_imbalance = 1 << 10,
+        exec_counters = 1 << 11,
+        create_memory = 1 << 12,
         // the upper 8 bits are reserved for devinfo levels
         debuginfo = 1 << 24,
         //
@@ -296,6 +299,9 @@ get_verbose_to_log_level_map() {
                     {verbose_t::create_profile, log_manager_t::info},
                     {verbose_t::profile_externals, log_manager_t::info},
                     {verbose_t::exec_profile, log_manager_t::info},
+                    {verbose_t::exec_imbalance, log_manager_t::info},
+                    {verbose_t::exec_counters, log_manager_t::info},
+                    {verbose_t::create_memory, log_manager_t::info},
                     {verbose_t::exec_check, log_manager_t::error},
                     {verbose_t::error, log_manager_t::critical},
                     {verbose_t::warn, log_manager_t::warn},
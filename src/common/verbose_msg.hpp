@@ -39,6 +39,9 @@
 #define VERBOSE_debug ":debug"
 #define VERBOSE_profile ""
 #define VERBOSE_external ":external"
+#define VERBOSE_imbalance ":imbalance"
+#define VERBOSE_counters ":counters"
+#define VERBOSE_memory ":memory"
 
 // verbose messages
 #define VERBOSE_PROFILING_UNSUPPORTED "profiling capabilities are not supported"
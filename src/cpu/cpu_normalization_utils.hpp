@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_NORMALIZATION_UTILS_HPP
+#define CPU_CPU_NORMALIZATION_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace normalization_utils {
+
+// Single-pass statistics use the shifted data algorithm: the values are
+// accumulated as `x - shift`, where `shift` is one of the values, together
+// with their squares. Since the shift is close to the mean compared to the
+// spread of the values in practice, the variance computed as
+// `(s2 - s1 * s1 / n) / n` does not suffer from the cancellation the naive
+// sum of squares is subject to. Partial sums computed by different threads
+// with the same shift are merged by summation.
+//
+// Returns false if more than `cancellation_bits` bits of precision would be
+// lost in the subtraction, which happens when the shift is an outlier. The
+// statistics should be recomputed with two passes over the data in this case.
+inline bool stats_from_shifted_sums(dim_t n, float shift, double s1, double s2,
+        float &mean, float &variance) {
+    static constexpr int cancellation_bits = 10;
+    if (n == 0) {
+        mean = 0.f;
+        variance = 0.f;
+        return true;
+    }
+
+    const double m2 = s2 - s1 * s1 / n;
+    if (m2 * (1 << cancellation_bits) < s2) return false;
+
+    mean = static_cast<float>(shift + s1 / n);
+    variance = static_cast<float>(nstl::max(m2, 0.) / n);
+    return true;
+}
+
+} // namespace normalization_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
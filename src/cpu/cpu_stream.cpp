@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "common/memory.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/scratchpad.hpp"
+#include "common/stream_impl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// A primitive submitted to an out-of-order stream may start as soon as all
+// previously submitted primitives it conflicts with are completed. Two
+// primitives conflict when they are the same primitive object (they would
+// share a scratchpad) or when the memory ranges of their arguments overlap
+// and at least one of them writes to the overlapping range.
+//
+// Each worker thread owns a global scratchpad large enough for the primitives
+// it executes, since the global scratchpad is thread-local and the one created
+// on the user thread is not visible to the workers.
+//
+// When `profiler` is not null, the execution of each task is recorded to it.
+//
+// When `cores` is not empty, the workers are pinned to these cores. OpenMP
+// threads created by a worker inherit its affinity mask, and memory first
+// touched by them (e.g. scratchpads) is allocated on the local NUMA node.
+struct cpu_async_queue_t {
+    cpu_async_queue_t(int nworkers, int nthr_per_worker,
+            cpu_stream_profiler_t *profiler,
+            const std::vector<int> &cores = {})
+        : nthr_per_worker_(nthr_per_worker)
+        , profiler_(profiler)
+        , cores_(cores) {
+        for (int i = 0; i < nworkers; i++)
+            workers_.emplace_back([this]() { worker_loop(); });
+    }
+
+    ~cpu_async_queue_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        task_cv_.notify_all();
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    status_t submit(const primitive_iface_t *primitive_iface,
+            const exec_ctx_t &ctx) {
+        task_t task(primitive_iface, ctx);
+        for (const auto &arg : ctx.args()) {
+            const memory_t *mem = arg.second.mem();
+            if (!mem) continue;
+            const auto begin = reinterpret_cast<uintptr_t>(
+                    mem->memory_storage()->data_handle());
+            const size_t size = memory_desc_wrapper(mem->md()).size();
+            if (begin == 0 || size == 0) continue;
+            task.regions.push_back(
+                    {begin, begin + size, !arg.second.is_const()});
+        }
+        // The task holds the primitive until it is executed. Memory objects
+        // are held by the execution context.
+        const_cast<primitive_iface_t *>(primitive_iface)->retain();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        task_cv_.notify_one();
+        return status::success;
+    }
+
+    status_t wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return tasks_.empty(); });
+        // Report the first failure since the previous wait and reset it
+        status_t status = status_;
+        status_ = status::success;
+        return status;
+    }
+
+private:
+    struct region_t {
+        uintptr_t begin;
+        uintptr_t end;
+        bool is_write;
+    };
+
+    struct task_t {
+        task_t(const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx)
+            : primitive_iface(primitive_iface), ctx(ctx) {}
+
+        const primitive_iface_t *primitive_iface;
+        exec_ctx_t ctx;
+        std::vector<region_t> regions;
+        bool is_running = false;
+    };
+
+    static bool conflict(const task_t &a, const task_t &b) {
+        if (a.primitive_iface == b.primitive_iface) return true;
+        for (const auto &ra : a.regions)
+            for (const auto &rb : b.regions) {
+                const bool overlap = ra.begin < rb.end && rb.begin < ra.end;
+                if (overlap && (ra.is_write || rb.is_write)) return true;
+            }
+        return false;
+    }
+
+    // Must be called under the lock. Returns the oldest task that does not
+    // depend on any task submitted before it.
+    std::list<task_t>::iterator find_ready_task() {
+        for (auto it = tasks_.begin(); it != tasks_.end(); ++it) {
+            if (it->is_running) continue;
+            bool is_ready = true;
+            for (auto dep = tasks_.begin(); dep != it; ++dep) {
+                if (conflict(*dep, *it)) {
+                    is_ready = false;
+                    break;
+                }
+            }
+            if (is_ready) return it;
+        }
+        return tasks_.end();
+    }
+
+    void worker_loop() {
+#if defined(__linux__)
+        if (!cores_.empty()) {
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            for (int core : cores_)
+                CPU_SET(core, &mask);
+            sched_setaffinity(0, sizeof(mask), &mask);
+        }
+#endif
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        // Workers share the threads available to the user thread that created
+        // the stream to avoid oversubscription.
+        omp_set_num_threads(nthr_per_worker_);
+#endif
+        std::unique_ptr<scratchpad_t> scratchpad;
+        size_t scratchpad_size = 0;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            auto it = tasks_.end();
+            task_cv_.wait(lock, [&]() {
+                it = find_ready_task();
+                return stop_ || it != tasks_.end();
+            });
+            if (it == tasks_.end()) break;
+
+            it->is_running = true;
+            lock.unlock();
+
+            const auto *pd = it->primitive_iface->pd()->impl().get();
+            const size_t size = pd->scratchpad_size(scratchpad_mode::library);
+            if (size > scratchpad_size) {
+                // A new global scratchpad expands the thread-local buffer
+                // before the previous one drops its reference.
+                scratchpad.reset(create_scratchpad(
+                        it->primitive_iface->engine(), size, true));
+                scratchpad_size = size;
+            }
+            const uint64_t begin_ticks
+                    = profiler_ ? cpu_stream_profiler_t::ticks() : 0;
+            status_t status = it->primitive_iface->execute(it->ctx);
+            if (profiler_)
+                profiler_->record(begin_ticks, cpu_stream_profiler_t::ticks());
+            const_cast<primitive_iface_t *>(it->primitive_iface)->release();
+
+            lock.lock();
+            if (status != status::success && status_ == status::success)
+                status_ = status;
+            tasks_.erase(it);
+            // Completion of a task may unblock its dependents
+            task_cv_.notify_all();
+            if (tasks_.empty()) done_cv_.notify_all();
+        }
+    }
+
+    int nthr_per_worker_;
+    cpu_stream_profiler_t *profiler_;
+    std::vector<int> cores_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable done_cv_;
+    // Tasks in submission order, including the ones being executed
+    std::list<task_t> tasks_;
+    status_t status_ = status::success;
+    bool stop_ = false;
+};
+
+cpu_stream_t::cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
+    : stream_t(engine, stream_impl) {
+    if (is_profiling_enabled())
+        profiler_ = utils::make_unique<cpu_stream_profiler_t>();
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    // Non-native runtimes (SYCL) provide their own out-of-order queues.
+    if ((flags() & stream_flags::out_of_order)
+            && is_native_runtime(engine->runtime_kind())) {
+        const int nworkers
+                = std::max(1, getenv_int_user("CPU_STREAM_WORKERS", 1));
+        const int nthr_per_worker
+                = std::max(1, dnnl_get_max_threads() / nworkers);
+        async_queue_ = utils::make_unique<cpu_async_queue_t>(
+                nworkers, nthr_per_worker, profiler_.get());
+    }
+#endif
+}
+
+cpu_stream_t::cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl,
+        const std::vector<int> &cpu_cores)
+    : stream_t(engine, stream_impl) {
+    assert(!cpu_cores.empty());
+    if (is_profiling_enabled())
+        profiler_ = utils::make_unique<cpu_stream_profiler_t>();
+    const int nworkers = (flags() & stream_flags::out_of_order)
+            ? std::max(1, getenv_int_user("CPU_STREAM_WORKERS", 1))
+            : 1;
+    const int nthr_per_worker
+            = std::max(1, static_cast<int>(cpu_cores.size()) / nworkers);
+    async_queue_ = utils::make_unique<cpu_async_queue_t>(
+            nworkers, nthr_per_worker, profiler_.get(), cpu_cores);
+}
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+cpu_stream_t::cpu_stream_t(engine_t *engine,
+        dnnl::threadpool_interop::threadpool_iface *threadpool)
+    : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+#endif
+
+cpu_stream_t::~cpu_stream_t() {
+    if (async_queue_) async_queue_->wait();
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (!async_queue_) {
+        const uint64_t begin_ticks
+                = profiler_ ? cpu_stream_profiler_t::ticks() : 0;
+        const status_t status
+                = stream_t::enqueue_primitive(primitive_iface, ctx);
+        if (profiler_)
+            profiler_->record(begin_ticks, cpu_stream_profiler_t::ticks());
+        return status;
+    }
+    CHECK(async_queue_->submit(primitive_iface, ctx));
+    // In-order streams offload execution to the pinned workers but keep
+    // the synchronous semantics
+    if (!(flags() & stream_flags::out_of_order)) return async_queue_->wait();
+    return status::success;
+}
+
+status_t cpu_stream_t::wait_async_queue() {
+    return async_queue_->wait();
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -23,21 +23,59 @@
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 #endif
 
+#include <memory>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/cpu_stream_profiler.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
+// Executes primitives submitted to an out-of-order CPU stream on a pool of
+// stream-owned worker threads. Dependencies between submitted primitives are
+// inferred from the memory arguments, see cpu_stream.cpp for details.
+struct cpu_async_queue_t;
+
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
-    ~cpu_stream_t() override = default;
+    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl);
+    // Creates a stream with workers pinned to `cpu_cores`, see
+    // dnnl_stream_create_with_cpu_affinity().
+    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl,
+            const std::vector<int> &cpu_cores);
+    ~cpu_stream_t() override;
+
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override;
+
+    dnnl::impl::status_t reset_profiling() override {
+        if (!profiler_) return stream_t::reset_profiling();
+        profiler_->reset();
+        return dnnl::impl::status::success;
+    }
+
+    dnnl::impl::status_t get_profiling_data(
+            dnnl::impl::profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const override {
+        if (!profiler_)
+            return stream_t::get_profiling_data(data_kind, num_entries, data);
+        return profiler_->get_info(data_kind, num_entries, data);
+    }
+
+    dnnl::impl::status_t notify_profiling_complete() const override {
+        if (!profiler_) return stream_t::notify_profiling_complete();
+        return dnnl::impl::status::success;
+    }
 
     dnnl::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
+        // Only out-of-order streams execute asynchronously, otherwise CPU
+        // execution is synchronous so return immediately
+        if (async_queue_) return wait_async_queue();
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         dnnl::threadpool_interop::threadpool_iface *tp;
         auto rc = this->get_threadpool(&tp);
@@ -52,8 +90,7 @@ struct cpu_stream_t : public stream_t {
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
-            dnnl::threadpool_interop::threadpool_iface *threadpool)
-        : stream_t(engine, new impl::stream_impl_t(threadpool)) {}
+            dnnl::threadpool_interop::threadpool_iface *threadpool);
 
     void before_exec_hook() override {
         dnnl::threadpool_interop::threadpool_iface *tp;
@@ -65,6 +102,13 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    dnnl::impl::status_t wait_async_queue();
+
+    // Must outlive the asynchronous queue, which records to it.
+    std::unique_ptr<cpu_stream_profiler_t> profiler_;
+    std::unique_ptr<cpu_async_queue_t> async_queue_;
 };
 
 } // namespace cpu
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_profiler.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Measures the frequency of the counter against the steady clock.
+double get_ticks_per_nsec() {
+    static const double ticks_per_nsec = []() {
+        using namespace std::chrono;
+        const auto t0 = steady_clock::now();
+        const uint64_t c0 = cpu_stream_profiler_t::ticks();
+        auto t1 = t0;
+        while (t1 - t0 < milliseconds(10))
+            t1 = steady_clock::now();
+        const uint64_t c1 = cpu_stream_profiler_t::ticks();
+        const double nsec = duration<double, std::nano>(t1 - t0).count();
+        return static_cast<double>(c1 - c0) / nsec;
+    }();
+    return ticks_per_nsec;
+}
+
+} // namespace
+
+cpu_stream_profiler_t::cpu_stream_profiler_t(size_t capacity)
+    : capacity_(capacity), entries_(new entry_t[capacity]) {
+    // Calibrate at stream creation rather than on the first query.
+    get_ticks_per_nsec();
+}
+
+uint64_t cpu_stream_profiler_t::ticks() {
+    return static_cast<uint64_t>(platform::get_timestamp());
+}
+
+status_t cpu_stream_profiler_t::get_info(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) const {
+    if (!num_entries) return status::invalid_arguments;
+
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    const uint64_t n = nstl::min(head, static_cast<uint64_t>(capacity_));
+    if (!data) {
+        *num_entries = static_cast<int>(n);
+        return status::success;
+    }
+
+    const double ticks_per_nsec = get_ticks_per_nsec();
+    for (uint64_t i = 0; i < n; i++) {
+        const auto &e = entries_[(head - n + i) % capacity_];
+        const uint64_t ticks = e.end - e.begin;
+        switch ((int)data_kind) {
+            // Each execution is reported as a single kernel.
+            case profiling_data_kind::time:
+            case profiling_data_kind::time_per_kernel:
+                data[i] = static_cast<uint64_t>(
+                        static_cast<double>(ticks) / ticks_per_nsec);
+                break;
+            case profiling_data_kind::cycles: data[i] = ticks; break;
+            default: return status::invalid_arguments;
+        }
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <atomic>
+#include <memory>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Collects the execution time of primitives submitted to a CPU stream created
+// with the profiling flag.
+//
+// Timestamps are taken with the cheapest monotonic counter of the platform
+// (TSC on x64) and converted to nanoseconds using the counter frequency
+// measured once per process. The entries are kept in a fixed-size ring buffer,
+// so only the latest `capacity` executions are reported. Writers reserve a
+// slot with an atomic increment and never block each other, which allows
+// workers of out-of-order streams to record concurrently.
+//
+// As on GPU, the data may only be queried once the stream is waited for.
+struct cpu_stream_profiler_t {
+    static constexpr size_t default_capacity = 4096;
+
+    cpu_stream_profiler_t(size_t capacity = default_capacity);
+
+    // Returns the current value of the counter.
+    static uint64_t ticks();
+
+    void record(uint64_t begin_ticks, uint64_t end_ticks) {
+        const uint64_t slot = head_.fetch_add(1, std::memory_order_relaxed);
+        entries_[slot % capacity_] = {begin_ticks, end_ticks};
+    }
+
+    void reset() { head_.store(0, std::memory_order_relaxed); }
+
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const;
+
+private:
+    struct entry_t {
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    size_t capacity_;
+    std::unique_ptr<entry_t[]> entries_;
+    std::atomic<uint64_t> head_ {0};
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -28,6 +28,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
+#include "cpu/cpu_normalization_utils.hpp"
 
 #include "cpu/nspc_batch_normalization.hpp"
 
@@ -88,7 +89,82 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
     const float eps = pd()->desc()->batch_norm_epsilon;
     const int nthr = pd()->nthr_;
 
+    // The statistics are computed in a single pass over src first. If the
+    // result is numerically unreliable for any channel, the mean and the
+    // variance are recomputed with separate passes.
+    bool two_pass_stats = false;
     if (calculate_stats) {
+        // The first point of each channel is used as the shift.
+        acc_data_t *ws_shift = ws_reduce + 2 * C * nthr;
+        if (utils::one_of(d_type, bf16, f16))
+            types::cvt_to_float(ws_shift, src, C);
+        else
+            utils::array_copy(
+                    ws_shift, reinterpret_cast<const acc_data_t *>(src), C);
+
+        parallel(nthr, [=](const int ithr, const int nthr) {
+            dim_t N_s = 0, N_e = 0;
+            balance211(N, nthr, ithr, N_s, N_e);
+
+            acc_data_t *s1 = ws_reduce + C * ithr;
+            acc_data_t *s2 = ws_reduce + C * nthr + C * ithr;
+            for (dim_t c = 0; c < C; c++) {
+                s1[c] = 0.;
+                s2[c] = 0.;
+            }
+
+            for (dim_t n = N_s; n < N_e; n++) {
+                for (dim_t sp = 0; sp < SP; sp++) {
+                    const acc_data_t *_src;
+                    const size_t s_off = (size_t)n * SP * C + sp * C;
+                    if (utils::one_of(d_type, bf16, f16)) {
+                        // convert src from xf16 to f32
+                        acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
+                        types::cvt_to_float(tmp_src, src + s_off, C);
+                        _src = tmp_src;
+                    } else {
+                        _src = reinterpret_cast<const acc_data_t *>(
+                                src + s_off);
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < C; c++) {
+                        const acc_data_t d = _src[c] - ws_shift[c];
+                        s1[c] += d;
+                        s2[c] += d * d;
+                    }
+                }
+            }
+        });
+
+        std::vector<char> is_stable(C);
+        parallel_nd(C, [&](dim_t c) {
+            double s1 = 0, s2 = 0;
+            for (dim_t n = 0; n < nthr; n++) {
+                s1 += ws_reduce[C * n + c];
+                s2 += ws_reduce[C * nthr + C * n + c];
+            }
+            is_stable[c] = normalization_utils::stats_from_shifted_sums(
+                    SP * N, ws_shift[c], s1, s2, mean[c], variance[c]);
+        });
+        two_pass_stats = std::any_of(is_stable.begin(), is_stable.end(),
+                [](char stable) { return !stable; });
+
+        if (!two_pass_stats) {
+            parallel(nthr, [=](const int ithr, const int nthr) {
+                const dim_t C_stride = nstl::max(C, (dim_t)16);
+                acc_data_t *mean_loc = tmp_mean + C_stride * ithr;
+                acc_data_t *variance_loc = tmp_var + C_stride * ithr;
+                if (ithr > 0 || save_stats) {
+                    for (dim_t c = 0; c < C; c++) {
+                        mean_loc[c] = mean[c];
+                        variance_loc[c] = variance[c];
+                    }
+                }
+            });
+        }
+    }
+
+    if (two_pass_stats) {
         parallel(nthr, [=](const int ithr, const int nthr) {
             dim_t N_s = 0, N_e = 0;
             balance211(N, nthr, ithr, N_s, N_e);
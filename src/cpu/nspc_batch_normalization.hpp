@@ -93,8 +93,10 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
                 const size_t stats_buf_sz = nstl::max(C(), dim_t(16)) * nthr_;
-                scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, stats_buf_sz);
+                // Single-pass statistics keep two sums per thread and the
+                // shift per channel.
+                scratchpad.template book<acc_data_t>(key_bnorm_reduction,
+                        2 * stats_buf_sz + nstl::max(C(), dim_t(16)));
                 scratchpad.template book<acc_data_t>(
                         key_bnorm_tmp_mean, stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
@@ -0,0 +1,322 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/cpu_isa_traits.hpp"
+#endif
+
+#include "cpu/perf_counters.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace perf_counters {
+
+#ifdef __linux__
+namespace {
+
+struct event_t {
+    kind_t kind;
+    uint32_t type;
+    uint64_t config;
+    // Value of a single count, e.g. the number of operations per instruction
+    double weight;
+};
+
+int open_event(uint32_t type, uint64_t config, pid_t pid, int cpu,
+        bool user_only) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+            | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = user_only;
+    attr.exclude_hv = user_only;
+    return static_cast<int>(
+            syscall(SYS_perf_event_open, &attr, pid, cpu, -1, 0));
+}
+
+// Returns the count of an event, extrapolated when the event shared a counter
+// with other events.
+double read_event(int fd) {
+    uint64_t buf[3] = {};
+    if (::read(fd, buf, sizeof(buf)) != sizeof(buf) || buf[2] == 0) return 0;
+    return static_cast<double>(buf[0]) * static_cast<double>(buf[1])
+            / static_cast<double>(buf[2]);
+}
+
+std::string read_file(const std::string &path) {
+    std::ifstream f(path);
+    std::string s;
+    std::getline(f, s);
+    return s;
+}
+
+const std::vector<event_t> &core_events() {
+    static const std::vector<event_t> events = []() {
+        std::vector<event_t> ev {
+                {cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 1.},
+                {llc_misses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,
+                        1.},
+        };
+#if DNNL_X64
+        if (x64::cpu().has(Xbyak::util::Cpu::tINTEL)) {
+            // FP_ARITH_INST_RETIRED umasks grouped by the number of
+            // operations per instruction: scalar, 128-bit double, 128-bit
+            // single and 256-bit double, 256-bit single and 512-bit double,
+            // 512-bit single.
+            const uint64_t fp_arith_event = 0xc7;
+            const std::pair<uint64_t, double> fp_arith_umasks[]
+                    = {{0x03, 1.}, {0x04, 2.}, {0x18, 4.}, {0x60, 8.},
+                            {0x80, 16.}};
+            for (const auto &u : fp_arith_umasks)
+                ev.push_back({flops, PERF_TYPE_RAW,
+                        (u.first << 8) | fp_arith_event, u.second});
+            if (x64::mayiuse(x64::amx_tile))
+                ev.push_back({amx_busy_cycles, PERF_TYPE_RAW,
+                        (0x02 << 8) | 0xb7, 1.});
+        }
+#endif
+        return ev;
+    }();
+    return events;
+}
+
+// Converts an event description of a PMU, e.g. `event=0x04,umask=0x0f`, to
+// the config value according to the format description of the PMU.
+bool parse_pmu_event(
+        const std::string &pmu_dir, const std::string &desc, uint64_t &config) {
+    config = 0;
+    std::istringstream ss(desc);
+    std::string term;
+    while (std::getline(ss, term, ',')) {
+        const auto pos = term.find('=');
+        if (pos == std::string::npos) return false;
+        // Formats look like `config:0-7` or `config:21`
+        const std::string format
+                = read_file(pmu_dir + "format/" + term.substr(0, pos));
+        if (format.rfind("config:", 0) != 0) return false;
+        const int shift = std::atoi(format.c_str() + 7);
+        config |= std::strtoull(term.c_str() + pos + 1, nullptr, 0) << shift;
+    }
+    return !desc.empty();
+}
+
+struct uncore_event_t {
+    int fd;
+    double bytes_per_count;
+};
+
+// Opens the read and write CAS counters of every memory controller. A PMU
+// counts for a whole socket on the CPUs listed in its cpumask.
+const std::vector<uncore_event_t> &uncore_events() {
+    static const std::vector<uncore_event_t> events = []() {
+        std::vector<uncore_event_t> ev;
+        const std::string root = "/sys/bus/event_source/devices/";
+        DIR *dir = opendir(root.c_str());
+        if (!dir) return ev;
+        while (const dirent *entry = readdir(dir)) {
+            const std::string name = entry->d_name;
+            if (name.rfind("uncore_imc", 0) != 0) continue;
+            const std::string pmu_dir = root + name + "/";
+            const uint32_t type = static_cast<uint32_t>(
+                    std::atoi(read_file(pmu_dir + "type").c_str()));
+            for (const char *e : {"cas_count_read", "cas_count_write"}) {
+                const std::string event_path = pmu_dir + "events/" + e;
+                uint64_t config = 0;
+                if (!parse_pmu_event(pmu_dir, read_file(event_path), config))
+                    continue;
+                // A CAS transfers a cache line, the kernel provides the scale
+                // to MiB.
+                double bytes_per_count = 64;
+                const double scale
+                        = std::atof(read_file(event_path + ".scale").c_str());
+                if (scale > 0 && read_file(event_path + ".unit") == "MiB")
+                    bytes_per_count = scale * 1024 * 1024;
+
+                std::istringstream cpus(read_file(pmu_dir + "cpumask"));
+                std::string cpu;
+                while (std::getline(cpus, cpu, ',')) {
+                    const int fd = open_event(
+                            type, config, -1, std::atoi(cpu.c_str()), false);
+                    if (fd >= 0) ev.push_back({fd, bytes_per_count});
+                }
+            }
+        }
+        closedir(dir);
+        return ev;
+    }();
+    return events;
+}
+
+struct thread_counters_t;
+
+struct registry_t {
+    static registry_t &get() {
+        // Never destroyed, threads may exit after the static objects are
+        // destroyed.
+        static registry_t *registry = new registry_t();
+        return *registry;
+    }
+
+    std::mutex mutex;
+    std::vector<const thread_counters_t *> threads;
+    // Counts of the exited threads
+    sample_t retired;
+    bool is_available[n_kinds] = {};
+};
+
+struct thread_counters_t {
+    thread_counters_t() {
+        const auto &events = core_events();
+        fds_.resize(events.size(), -1);
+        for (size_t i = 0; i < events.size(); i++)
+            fds_[i] = open_event(
+                    events[i].type, events[i].config, 0, -1, true);
+
+        auto &r = registry_t::get();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (size_t i = 0; i < events.size(); i++)
+            if (fds_[i] >= 0) r.is_available[events[i].kind] = true;
+        r.threads.push_back(this);
+    }
+
+    ~thread_counters_t() {
+        auto &r = registry_t::get();
+        {
+            std::lock_guard<std::mutex> lock(r.mutex);
+            add_to(r.retired);
+            r.threads.erase(
+                    std::find(r.threads.begin(), r.threads.end(), this));
+        }
+        for (int fd : fds_)
+            if (fd >= 0) close(fd);
+    }
+
+    void add_to(sample_t &sample) const {
+        const auto &events = core_events();
+        for (size_t i = 0; i < events.size(); i++) {
+            if (fds_[i] < 0) continue;
+            sample.values[events[i].kind]
+                    += events[i].weight * read_event(fds_[i]);
+        }
+    }
+
+private:
+    std::vector<int> fds_;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(thread_counters_t);
+};
+
+void attach_thread() {
+    static thread_local thread_counters_t counters;
+    MAYBE_UNUSED(counters);
+}
+
+bool is_available(kind_t kind) {
+    if (kind == dram_bytes) return !uncore_events().empty();
+    auto &r = registry_t::get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    return r.is_available[kind];
+}
+
+} // namespace
+
+void attach_threads() {
+    parallel(0, [](int, int) { attach_thread(); });
+}
+
+void read(sample_t &sample) {
+    sample = sample_t();
+    auto &r = registry_t::get();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        sample = r.retired;
+        for (const auto *t : r.threads)
+            t->add_to(sample);
+    }
+    for (const auto &e : uncore_events())
+        sample.values[dram_bytes] += e.bytes_per_count * read_event(e.fd);
+}
+
+std::string to_string(
+        const sample_t &begin, const sample_t &end, double duration_ms) {
+    static const char *names[n_kinds] = {"cycles", "llc_misses", "flops",
+            "amx_busy_cycles", "dram_bytes"};
+    double delta[n_kinds];
+    for (int k = 0; k < n_kinds; k++)
+        delta[k] = std::max(0., end.values[k] - begin.values[k]);
+
+    std::ostringstream ss;
+    const char *delim = "";
+    for (int k = 0; k < n_kinds; k++) {
+        if (!is_available(static_cast<kind_t>(k))) continue;
+        ss << delim << names[k] << ":" << static_cast<uint64_t>(delta[k]);
+        delim = ",";
+    }
+    if (duration_ms > 0) {
+        const double nsec = duration_ms * 1e6;
+        if (is_available(dram_bytes)) {
+            ss << delim << "gbps:" << delta[dram_bytes] / nsec;
+            delim = ",";
+        }
+        if (is_available(flops))
+            ss << delim << "gflops:" << delta[flops] / nsec;
+    }
+    return ss.str();
+}
+
+#else
+
+void attach_threads() {}
+
+void read(sample_t &sample) {
+    sample = sample_t();
+}
+
+std::string to_string(
+        const sample_t &begin, const sample_t &end, double duration_ms) {
+    return std::string();
+}
+
+#endif
+
+} // namespace perf_counters
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_PERF_COUNTERS_HPP
+#define CPU_PERF_COUNTERS_HPP
+
+#include <string>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Hardware performance counters collected with Linux perf_event_open() for
+// the exec verbose profiling, see `ONEDNN_VERBOSE=profile_counters`.
+//
+// Core events are counted per thread, in user space only, for every thread
+// that runs a parallel region of the library. DRAM traffic is counted by the
+// memory controller uncore PMUs, which are system-wide and require
+// `perf_event_paranoid` to be at most 0. Events that cannot be opened are not
+// reported.
+namespace perf_counters {
+
+enum kind_t {
+    cycles = 0,
+    llc_misses,
+    // Floating-point operations of retired arithmetic instructions (Intel
+    // FP_ARITH events). Fused multiply-adds count as two operations.
+    flops,
+    // Cycles the AMX unit is busy (Intel EXE.AMX_BUSY event).
+    amx_busy_cycles,
+    dram_bytes,
+    n_kinds,
+};
+
+struct sample_t {
+    double values[n_kinds] = {};
+};
+
+// Opens the counters on the threads that may run the next parallel regions.
+void attach_threads();
+
+// Reads the accumulated counter values.
+void read(sample_t &sample);
+
+// Formats the difference between two samples together with the achieved
+// bandwidth and compute throughput, e.g.
+// `cycles:1000,llc_misses:20,...,gbps:1.2,gflops:3.4`.
+std::string to_string(
+        const sample_t &begin, const sample_t &end, double duration_ms);
+
+} // namespace perf_counters
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
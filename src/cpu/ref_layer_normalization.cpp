@@ -38,6 +38,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const memory_desc_wrapper sc_d(pd()->weights_md());
 
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto residual = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
     auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const void *, DNNL_ARG_SHIFT);
     auto mean = pd()->stats_are_src()
@@ -47,6 +48,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto residual_dst = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
 
     const float *src_scales
             = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
@@ -65,6 +67,17 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
     const bool skip_mean = pd()->skip_mean();
+    const bool use_residual = pd()->use_residual();
+    const bool output_residual = pd()->output_residual();
+
+    // Returns the normalized value, which is the sum of the source and the
+    // residual when the latter is used.
+    auto load_src = [&](dim_t off) {
+        float s = io::load_float_value(src_d.data_type(), src, off);
+        if (use_residual)
+            s += io::load_float_value(src_d.data_type(), residual, off);
+        return s;
+    };
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -86,16 +99,14 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             if (!skip_mean) {
                 for (dim_t c = 0; c < C; ++c) {
                     const auto s_off = src_d.off_l(n * C + c);
-                    float s = io::load_float_value(
-                            src_d.data_type(), src, s_off);
-                    v_mean += s;
+                    v_mean += load_src(s_off);
                 }
                 v_mean /= C;
             }
 
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
+                float s = load_src(s_off);
                 float m = s - v_mean;
                 v_variance += m * m;
             }
@@ -114,7 +125,9 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             const float sm = scale_val / sqrt_variance;
             const auto s_off = src_d.off_l(n * C + c);
             const auto d_off = dst_d.off_l(n * C + c);
-            float s = io::load_float_value(src_d.data_type(), src, s_off);
+            float s = load_src(s_off);
+            if (output_residual)
+                io::store_float_value(src_d.data_type(), s, residual_dst, s_off);
             float d = sm * (s - v_mean) + shift_val;
             if (with_src_scales) d *= src_scales[0];
 
@@ -49,8 +49,8 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
             VDISPATCH_LNORM(
                     utils::one_of(src_md()->data_type, f32, bf16, f16, s8, u8),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_LNORM(
-                    utils::one_of(dst_md()->data_type, f32, bf16, f16, s8, u8),
+            VDISPATCH_LNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16,
+                                    s8, u8, f8_e5m2, f8_e4m3),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_LNORM(
                     platform::has_data_type_support(src_md()->data_type),
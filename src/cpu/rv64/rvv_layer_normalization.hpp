@@ -46,6 +46,8 @@ struct rvv_layer_normalization_fwd_t : public primitive_t {
             const memory_desc_wrapper dst_d(dst_md());
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!use_residual(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "residual");
             VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
 
             VDISPATCH_LNORM(
@@ -172,6 +172,16 @@ status_t dnnl_brgemm_execute(const brgemm_t *brgemm, const void *A_ptr,
     return status::unimplemented;
 }
 
+status_t dnnl_brgemm_execute_batch(const brgemm_t *brgemm,
+        const brgemm_problem_t *problems, dim_t nproblems,
+        void *scratchpad_ptr, int nthr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_execute_batch(
+            brgemm, problems, nproblems, scratchpad_ptr, nthr);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_brgemm_execute_postops(const brgemm_t *brgemm, const void *A_ptr,
         const void *B_ptr, const dim_t *A_B_offsets, const void *C_ptr,
         void *D_ptr, void *scratchpad_ptr, const attr_params_t *attr_params) {
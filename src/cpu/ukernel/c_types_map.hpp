@@ -39,6 +39,7 @@ const pack_type_t pack32 = dnnl_pack_type_pack32;
 
 using attr_params_t = dnnl_ukernel_attr_params;
 using brgemm_t = dnnl_brgemm;
+using brgemm_problem_t = dnnl_brgemm_problem_t;
 using transform_t = dnnl_transform;
 
 } // namespace ukernel
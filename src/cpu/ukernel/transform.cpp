@@ -46,6 +46,24 @@ status_t dnnl_transform_create(transform_t **transform, dim_t K, dim_t N,
     return status::unimplemented;
 }
 
+status_t dnnl_transform_set_B_scales(transform_t *transform, int b_scale_mask,
+        dim_t k_group_size, data_type_t b_scale_dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_set_B_scales(
+            transform, b_scale_mask, k_group_size, b_scale_dt);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_transform_set_B_zero_points(transform_t *transform,
+        int b_zp_mask, dim_t k_group_size, data_type_t b_zp_dt) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_set_B_zero_points(
+            transform, b_zp_mask, k_group_size, b_zp_dt);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_generate(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_generate(transform);
@@ -65,6 +83,15 @@ status_t dnnl_transform_execute(
     return status::unimplemented;
 }
 
+status_t dnnl_transform_execute_ext(const transform_t *transform,
+        const void *in_ptr, void *out_ptr, const attr_params_t *attr_params) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_transform_execute_ext(
+            transform, in_ptr, out_ptr, attr_params);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_destroy(transform);
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_HPP
 #define CPU_X64_BRGEMM_BRGEMM_HPP
 
+#include <memory>
+
 #include "cpu/x64/brgemm/brgemm_types.hpp"
 
 namespace dnnl {
@@ -185,6 +187,18 @@ status_t DNNL_API brgemm_desc_finalize(brgemm_desc_t *brg);
 status_t DNNL_API brgemm_kernel_create(
         brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg);
 
+/// Returns a BRGEMM kernel for the descriptor shared by all primitives in the
+/// process. The kernel is looked up in the kernel cache by the descriptor,
+/// including its attributes and destination memory descriptor, and is only
+/// generated on a cache miss.
+///
+/// @param brg_kernel Output BRGEMM kernel
+/// @param brg BRGEMM descriptor
+///
+status_t brgemm_kernel_get_or_create(
+        std::shared_ptr<const brgemm_kernel_t> &brg_kernel,
+        const brgemm_desc_t &brg);
+
 /// Destroys a BRGEMM kernel
 ///
 /// @param brg_kernel BRGEMM kernel
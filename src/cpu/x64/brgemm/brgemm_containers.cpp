@@ -26,13 +26,13 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
-std::set<std::shared_ptr<brgemm_kernel_t>,
+std::set<std::shared_ptr<const brgemm_kernel_t>,
         decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
 brgemm_kernel_container_t::get_set() {
 #ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static std::set<std::shared_ptr<brgemm_kernel_t>,
+    static std::set<std::shared_ptr<const brgemm_kernel_t>,
             decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ = std::set<std::shared_ptr<brgemm_kernel_t>,
+            set_ = std::set<std::shared_ptr<const brgemm_kernel_t>,
                     decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
                     brgemm_kernel_container_t::brgemm_kernel_cmp);
 #endif
@@ -90,8 +90,8 @@ int brgemm_desc_container_t::insert(brgemm_desc_t &brg,
 }
 
 bool brgemm_kernel_container_t::brgemm_kernel_cmp(
-        const std::shared_ptr<brgemm_kernel_t> &lhs,
-        const std::shared_ptr<brgemm_kernel_t> &rhs) {
+        const std::shared_ptr<const brgemm_kernel_t> &lhs,
+        const std::shared_ptr<const brgemm_kernel_t> &rhs) {
     const auto lsz = lhs->get_jit_generator()->getSize();
     const auto rsz = rhs->get_jit_generator()->getSize();
     if (lsz != rsz) return (lsz < rsz);
@@ -106,11 +106,13 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // key (we can check if brgemm descriptor is unique inside brgemm primitive)
     // 2. Only if we do not find entry in local brgemm_map_  then try to find
     // entry in kernel storage using kernel code as key
+    //
+    // Kernels themselves come from the process-wide kernel cache, so the
+    // primitives with the same brgemm descriptors share the generated code.
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
-        std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
+        std::shared_ptr<const brgemm_kernel_t> sptr;
+        CHECK(brgemm_kernel_get_or_create(sptr, *brg));
         lock_write();
         const auto kernel_ret = get_set().insert(std::move(sptr));
         refs_[idx] = kernel_ret.first->get();
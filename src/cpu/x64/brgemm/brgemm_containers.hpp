@@ -79,8 +79,9 @@ struct brgemm_kernel_container_t {
     }
 
     status_t insert(int idx, const brgemm_desc_t *brg);
-    static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
-            const std::shared_ptr<brgemm_kernel_t> &rhs);
+    static bool brgemm_kernel_cmp(
+            const std::shared_ptr<const brgemm_kernel_t> &lhs,
+            const std::shared_ptr<const brgemm_kernel_t> &rhs);
 
 private:
     std::vector<const brgemm_kernel_t *> refs_;
@@ -94,16 +95,16 @@ private:
     void unlock_write() { rw_mutex().unlock_write(); }
 
 #else
-    std::set<std::shared_ptr<brgemm_kernel_t>,
+    std::set<std::shared_ptr<const brgemm_kernel_t>,
             decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ {std::set<std::shared_ptr<brgemm_kernel_t>,
+            set_ {std::set<std::shared_ptr<const brgemm_kernel_t>,
                     decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
                     brgemm_kernel_container_t::brgemm_kernel_cmp)};
 
     void lock_write() {}
     void unlock_write() {}
 #endif
-    std::set<std::shared_ptr<brgemm_kernel_t>,
+    std::set<std::shared_ptr<const brgemm_kernel_t>,
             decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
     get_set();
 
@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/kernel_cache.hpp"
+#include "common/primitive_hashing.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+
+// `brgemm_desc_t::operator==` is only guaranteed to distinguish descriptors
+// created within a single primitive. Descriptors coming from different
+// primitives may also differ in attributes, destination memory descriptor and
+// fields controlled by the implementation, which are compared here.
+bool is_same_kernel(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
+    if (!(lhs == rhs)) return false;
+
+#define CMP_BRGEMM_FIELD(x) \
+    if ((lhs.x) != (rhs.x)) return false
+
+    CMP_BRGEMM_FIELD(fused_copy_a);
+    CMP_BRGEMM_FIELD(req_comp_pads_with_bcast);
+    CMP_BRGEMM_FIELD(skip_zp_b_compensation);
+    CMP_BRGEMM_FIELD(n_bcast_1_load);
+
+    CMP_BRGEMM_FIELD(is_blocked);
+    CMP_BRGEMM_FIELD(bdb);
+    CMP_BRGEMM_FIELD(bd_block);
+    CMP_BRGEMM_FIELD(bdb_tail);
+    CMP_BRGEMM_FIELD(bdb2);
+    CMP_BRGEMM_FIELD(bd_block2);
+    CMP_BRGEMM_FIELD(bdb2_tail);
+    CMP_BRGEMM_FIELD(ldb);
+    CMP_BRGEMM_FIELD(ld_block);
+    CMP_BRGEMM_FIELD(ldb_tail);
+    CMP_BRGEMM_FIELD(ldb2);
+    CMP_BRGEMM_FIELD(ld_block2);
+    CMP_BRGEMM_FIELD(ldb2_tail);
+    CMP_BRGEMM_FIELD(rdb);
+    CMP_BRGEMM_FIELD(rd_block);
+    CMP_BRGEMM_FIELD(rdb_tail);
+    CMP_BRGEMM_FIELD(rd_step);
+    CMP_BRGEMM_FIELD(ld_step);
+
+    CMP_BRGEMM_FIELD(load_nt_A);
+    CMP_BRGEMM_FIELD(load_nt_B);
+    CMP_BRGEMM_FIELD(embd_bcst);
+    CMP_BRGEMM_FIELD(with_bias);
+    CMP_BRGEMM_FIELD(req_s8s8_compensation);
+    CMP_BRGEMM_FIELD(with_weights_scale_adjust);
+    CMP_BRGEMM_FIELD(innermost_loop);
+    CMP_BRGEMM_FIELD(is_M_tail);
+    CMP_BRGEMM_FIELD(interleave_tilestores_);
+    CMP_BRGEMM_FIELD(is_runtime_lda);
+    CMP_BRGEMM_FIELD(is_runtime_ldb);
+    CMP_BRGEMM_FIELD(is_runtime_ldc);
+    CMP_BRGEMM_FIELD(is_runtime_ldd);
+    CMP_BRGEMM_FIELD(transA);
+    CMP_BRGEMM_FIELD(is_gemv);
+    CMP_BRGEMM_FIELD(treat_y_as_row);
+    CMP_BRGEMM_FIELD(gemv_transa_bd_unroll);
+    CMP_BRGEMM_FIELD(gemv_tail);
+
+#undef CMP_BRGEMM_FIELD
+
+    auto is_same_prf = [](const brgemm_prf_t &a, const brgemm_prf_t &b) {
+        return a.dist0 == b.dist0 && a.dist1 == b.dist1 && a.dist2 == b.dist2
+                && a.distNTA == b.distNTA && a.sprinkled == b.sprinkled;
+    };
+    if (!is_same_prf(lhs.prfA, rhs.prfA) || !is_same_prf(lhs.prfB, rhs.prfB)
+            || !is_same_prf(lhs.prfC, rhs.prfC))
+        return false;
+
+    const auto *lattr = lhs.attr();
+    const auto *rattr = rhs.attr();
+    if (!lattr != !rattr) return false;
+    if (lattr && !(*lattr == *rattr)) return false;
+
+    const auto *ldst_md = lhs.dst_md();
+    const auto *rdst_md = rhs.dst_md();
+    if (!ldst_md != !rdst_md) return false;
+    if (ldst_md && !(*ldst_md == *rdst_md)) return false;
+
+    return true;
+}
+
+struct brgemm_kernel_key_t : public kernel_cache::key_impl_t {
+    brgemm_kernel_key_t(const brgemm_desc_t &brg) : brg_(brg) {
+        // The descriptor refers to arrays owned by the primitive, which may
+        // be destroyed before the key is evicted.
+        if (brg_.brgattr.bd_mask_level > 0 && brg_.brgattr.bd_mask) {
+            bd_mask_.assign(brg_.brgattr.bd_mask,
+                    brg_.brgattr.bd_mask + brg_.bcast_dim);
+            brg_.brgattr.bd_mask = bd_mask_.data();
+        }
+        if (brg_.type == brgemm_static_offs && brg_.brgattr.static_offsets) {
+            static_offsets_.assign(brg_.brgattr.static_offsets,
+                    brg_.brgattr.static_offsets + brg_.brgattr.max_bs);
+            brg_.brgattr.static_offsets = static_offsets_.data();
+        }
+
+        size_t seed = 0;
+        seed = hash_combine(seed, brg_.bcast_dim);
+        seed = hash_combine(seed, brg_.load_dim);
+        seed = hash_combine(seed, brg_.reduce_dim);
+        seed = hash_combine(seed, brg_.LDA);
+        seed = hash_combine(seed, brg_.LDB);
+        seed = hash_combine(seed, brg_.LDC);
+        seed = hash_combine(seed, brg_.LDD);
+        seed = hash_combine(seed, static_cast<size_t>(brg_.isa_impl));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_a));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_b));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.dt_d));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.type));
+        seed = hash_combine(seed, static_cast<size_t>(brg_.layout));
+        seed = hash_combine(seed, brg_.brgattr.max_bs);
+        seed = hash_combine(seed, brg_.bd_block);
+        seed = hash_combine(seed, brg_.ld_block);
+        seed = hash_combine(seed, brg_.rd_block);
+        if (brg_.attr())
+            seed = hash_combine(
+                    seed, primitive_hashing::get_attr_hash(*brg_.attr()));
+        if (brg_.dst_md())
+            seed = hash_combine(
+                    seed, primitive_hashing::get_md_hash(*brg_.dst_md()));
+        hash_ = seed;
+    }
+
+    bool compare(const key_impl_t *key_impl) const override {
+        const auto *other = dynamic_cast<const brgemm_kernel_key_t *>(key_impl);
+        if (other == nullptr) return false;
+        return hash_ == other->hash_ && is_same_kernel(brg_, other->brg_);
+    }
+
+    size_t hash() const override { return hash_; }
+
+    const brgemm_desc_t &brg() const { return brg_; }
+
+private:
+    brgemm_desc_t brg_;
+    std::vector<char> bd_mask_;
+    std::vector<brgemm_batch_element_t> static_offsets_;
+    size_t hash_ = 0;
+};
+
+struct brgemm_kernel_value_t : public kernel_cache::value_impl_t {
+    brgemm_kernel_value_t(std::shared_ptr<const brgemm_kernel_t> kernel)
+        : kernel(std::move(kernel)) {}
+    std::shared_ptr<const brgemm_kernel_t> kernel;
+};
+
+} // namespace
+
+status_t brgemm_kernel_get_or_create(
+        std::shared_ptr<const brgemm_kernel_t> &brg_kernel,
+        const brgemm_desc_t &brg) {
+    brg_kernel.reset();
+
+    auto key_impl = std::make_shared<brgemm_kernel_key_t>(brg);
+    const auto &key_brg = key_impl->brg();
+    kernel_cache::key_t key {std::move(key_impl)};
+
+    // Kernels are generated from the descriptor owned by the key, so the
+    // arrays referenced by it stay alive during the generation.
+    kernel_cache::iface_t::create_func_ptr_t create = [](void *context) {
+        const auto &brg = *static_cast<const brgemm_desc_t *>(context);
+        brgemm_kernel_t *kernel = nullptr;
+        const status_t status = brgemm_kernel_create(&kernel, brg);
+        if (status != status::success)
+            return kernel_cache::iface_t::result_t {nullptr, status};
+        std::shared_ptr<kernel_cache::value_impl_t> value
+                = std::make_shared<brgemm_kernel_value_t>(
+                        std::shared_ptr<const brgemm_kernel_t>(kernel));
+        return kernel_cache::iface_t::result_t {
+                kernel_cache::value_t(std::move(value)), status::success};
+    };
+
+    auto result = kernel_cache::get().get_or_create(
+            key, *create, const_cast<brgemm_desc_t *>(&key_brg));
+    CHECK(result.status);
+    brg_kernel = utils::downcast<const brgemm_kernel_value_t *>(
+            result.value.impl().get())
+                         ->kernel;
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
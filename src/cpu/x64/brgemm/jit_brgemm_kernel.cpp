@@ -123,9 +123,13 @@ struct jit_brgemm_kernel_t : public jit_base_brgemm_kernel_t {
                     binary_injector::get_all_strategies_supported_by_injector(),
                     rhs_sp, f8_e5m2_cvt_.get(), f8_e4m3_cvt_.get()};
 
+            eltwise_injector::static_params_t esp;
+            esp.fast_approx
+                    = eltwise_injector::is_fast_approx_allowed(brg.attr());
+
             auto st = safe_ptr_assign(postops_injector_,
-                    po_injector_t::create(
-                            this, brg.isa_impl, brg.attr()->post_ops_, bsp));
+                    po_injector_t::create(this, brg.isa_impl,
+                            brg.attr()->post_ops_, bsp, esp));
             if (st != status::success) {
                 assert(!"postops_injector creation failed");
             }
@@ -59,6 +59,14 @@ bool is_supported(cpu_isa_t isa, alg_kind_t alg, data_type_t dt) {
 
 #undef VCHECK_ELT_INJ_BOOL
 
+bool is_fast_approx_allowed(const primitive_attr_t *attr) {
+    // The modes that allow implicit down-conversion to 16-bit floating-point
+    // types tolerate errors larger than those of the approximations.
+    return attr
+            && utils::one_of(attr->fpmath_.mode_, fpmath_mode::bf16,
+                    fpmath_mode::f16, fpmath_mode::any);
+}
+
 } // namespace eltwise_injector
 
 using namespace Xbyak;
@@ -445,9 +453,13 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::exp_compute_vector_fwd(
     blend_with_mask(vmm_aux(1), vmm_src);
 
     // compute polynomial
-    h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 3));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 2));
+    if (fast_approx_) {
+        h->uni_vmovups(vmm_src, table_val(exp_pol, 2));
+    } else {
+        h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 3));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 2));
+    }
     h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 1));
     h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 0));
     h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(one));
@@ -494,6 +506,15 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::tanh_compute_vector_fwd(
     // we add a check as the avx2 code cannot be used for avx
     assert(IMPLICATION(isa == avx2, mayiuse(avx2)));
 
+    if (fast_approx_) {
+        // tanh(x) = 2 * logistic(2 * x) - 1
+        h->uni_vaddps(vmm_src, vmm_src, vmm_src);
+        logistic_compute_vector_fwd(vmm_src);
+        h->uni_vaddps(vmm_src, vmm_src, vmm_src);
+        h->uni_vsubps(vmm_src, vmm_src, table_val(one));
+        return;
+    }
+
     using namespace Xbyak::util;
     const int XMM_float_lanes_count = 4;
     const int tanh_n_polynomials = 32;
@@ -949,7 +970,13 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::logistic_compute_vector_fwd(
     // (exp(x) + 1)
     h->uni_vaddps(vmm_aux(0), vmm_aux(0), table_val(one));
     // y = exp(x) / (exp(x) + 1)
-    h->uni_vdivps(vmm_src, vmm_src, vmm_aux(0));
+    if (fast_approx_) {
+        // No Newton-Raphson refinement for the reciprocal
+        h->uni_vrcpps(vmm_aux(0), vmm_aux(0));
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux(0));
+    } else {
+        h->uni_vdivps(vmm_src, vmm_src, vmm_aux(0));
+    }
 
     // Now we have to apply the "symmetry" based on original sign
     h->uni_vmovups(vmm_aux(1), table_val(one));
@@ -2210,6 +2237,15 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
             {exp_pol, {0x3c07cfce, true}} // p5 = 0.00828929059f
     };
 
+    // exp(x) polynomial approximation of lower degree with relative error
+    // about 1e-4
+    static const table_t exp_polynomial_fast {
+            // p0 = 1.0f
+            {exp_pol, {0x3f80066b, true}}, // p1 = 1.00019586f
+            {exp_pol, {0x3f010eb6, true}}, // p2 = 0.504130721f
+            {exp_pol, {0x3e2924bc, true}} // p3 = 0.165179193f
+    };
+
     // mish(x) constants
     static const table_t mish_consts {
             {fwd_mish_max_x_for_equation_f, {0x42317217, true}},
@@ -2895,11 +2931,14 @@ void jit_uni_eltwise_injector_t<isa, Wmm>::register_table_entries() {
     push_arg_entry_of(alpha, float2int(alpha_), true);
     push_arg_entry_of(beta, float2int(beta_), true);
     push_entries_of(common_values);
-    if (need.exp()) push_entries_of(exp_consts);
-    if (need.exp()) push_entries_of(exp_polynomial);
+    // Fast tanh is computed through exp
+    const bool need_exp = need.exp() || (need.tanh() && fast_approx_);
+    if (need_exp) push_entries_of(exp_consts);
+    if (need_exp)
+        push_entries_of(fast_approx_ ? exp_polynomial_fast : exp_polynomial);
     if (need.mish()) push_entries_of(mish_consts);
-    if (need.tanh()) push_entries_of(tanh_consts);
-    if (need.tanh()) push_entries_of(tanh_polynomial_table);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_consts);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_polynomial_table);
     if (need.soft_relu()) push_entries_of(soft_relu_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_polynomial);
     if (need.gelu_tanh()) push_entries_of(gelu_tanh_consts);
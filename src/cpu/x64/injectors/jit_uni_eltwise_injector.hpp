@@ -40,14 +40,15 @@ struct static_params_t {
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true, bool fast_approx = false)
         : save_state(save_state)
         , p_table_(p_table)
         , k_mask_(k_mask)
         , is_fwd(is_fwd)
         , use_dst(use_dst)
         , preserve_vmm(preserve_vmm)
-        , preserve_p_table(preserve_p_table) {}
+        , preserve_p_table(preserve_p_table)
+        , fast_approx(fast_approx) {}
 
     bool save_state;
     Xbyak::Reg64 p_table_;
@@ -56,6 +57,7 @@ struct static_params_t {
     bool use_dst;
     bool preserve_vmm;
     bool preserve_p_table;
+    bool fast_approx;
 };
 
 /*
@@ -73,6 +75,12 @@ bool is_alg_supported(alg_kind_t alg);
  */
 bool is_supported(cpu_isa_t isa, alg_kind_t alg, data_type_t dt);
 
+/*
+ * Checks if the floating-point math mode of the attributes allows the
+ * injector to use fast approximations, see `fast_approx` argument.
+ */
+bool is_fast_approx_allowed(const primitive_attr_t *attr);
+
 } // namespace eltwise_injector
 
 template <cpu_isa_t isa, typename Wmm = typename cpu_isa_traits_t<isa>::Vmm>
@@ -91,13 +99,16 @@ struct jit_uni_eltwise_injector_t {
     //   - algorithm derivative.
     // use_dst - defines whether source or destination point is passed to alg
     //   code. Depends on algorithm. See `_use_dst_for_bwd` algs definition.
+    // fast_approx - when true, forward exp, logistic, swish, tanh and
+    //   gelu_tanh use cheaper sequences with relative error around 1e-4
+    //   instead of a few ulps.
     jit_uni_eltwise_injector_t(jit_generator_t *host, alg_kind_t alg,
             float alpha, float beta, float scale,
             data_type_t dt = data_type::f32, bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true, bool fast_approx = false)
         : alg_(alg)
         , alpha_(alpha)
         , beta_(beta)
@@ -111,6 +122,7 @@ struct jit_uni_eltwise_injector_t {
         , use_dst_(use_dst)
         , preserve_vmm_(preserve_vmm)
         , preserve_p_table_(preserve_p_table)
+        , fast_approx_(fast_approx && is_fwd)
         , n_vregs_to_preserve_(aux_vecs_count(alg_, is_fwd_, alpha_)) {
         assert(eltwise_injector::is_supported(isa, alg_, dt_));
 
@@ -123,10 +135,11 @@ struct jit_uni_eltwise_injector_t {
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true, bool fast_approx = false)
         : jit_uni_eltwise_injector_t(host, eltwise.alg, eltwise.alpha,
                   eltwise.beta, eltwise.scale, dt, save_state, p_table, k_mask,
-                  is_fwd, use_dst, preserve_vmm, preserve_p_table) {}
+                  is_fwd, use_dst, preserve_vmm, preserve_p_table,
+                  fast_approx) {}
 
     void compute_vector_range(size_t start_compute_idx, size_t end_compute_idx,
             const injector_utils::vmm_index_set_t &vmm_aux_indices = {});
@@ -162,6 +175,7 @@ private:
     const bool use_dst_;
     const bool preserve_vmm_;
     const bool preserve_p_table_;
+    const bool fast_approx_;
 
     Xbyak::Label l_table_;
 
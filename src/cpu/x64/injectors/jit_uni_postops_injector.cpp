@@ -78,7 +78,8 @@ jit_uni_postops_injector_t<isa, Vmm>::jit_uni_postops_injector_t(
                     jit_uni_eltwise_injector_t<isa, Vmm>(host_, post_op.eltwise,
                             data_type::f32, esp.save_state, esp.p_table_,
                             esp.k_mask_, esp.is_fwd, esp.use_dst,
-                            esp.preserve_vmm, esp.preserve_p_table));
+                            esp.preserve_vmm, esp.preserve_p_table,
+                            esp.fast_approx));
         } else if (post_op.is_like_binary()) {
             is_like_binary = true;
         }
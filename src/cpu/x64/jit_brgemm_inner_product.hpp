@@ -207,9 +207,8 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K, bs);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(brgemm_kernel_get_or_create(
+                    brg_kernels_[idx], pd()->brg_descs_[idx]));
             if (pd()->jbgp_.is_amx)
                 brgemm_palettes_.insert(idx, pd()->brg_descs_[idx]);
         }
@@ -232,7 +231,7 @@ private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<brgemm_kernel_t>
+    std::shared_ptr<const brgemm_kernel_t>
             brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
     std::unique_ptr<jit_brgemm_copy_to_coarse_t> copy_src_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_;
@@ -384,9 +383,8 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K, bs);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(brgemm_kernel_get_or_create(
+                    brg_kernels_[idx], pd()->brg_descs_[idx]));
             if (jbgp.is_amx)
                 brgemm_palettes_.insert(idx, pd()->brg_descs_[idx]);
         }
@@ -415,7 +413,7 @@ private:
     void execute_backward_data(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<brgemm_kernel_t>
+    std::shared_ptr<const brgemm_kernel_t>
             brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
     std::unique_ptr<jit_brgemm_copy_to_coarse_t> copy_diff_dst_kernel_;
     std::unique_ptr<jit_brgemm_trans_wei_t> trans_B_kernel_;
@@ -573,9 +571,8 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
             int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K, bs);
             if (idx < 0) continue;
 
-            brgemm_kernel_t *ker = nullptr;
-            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
-            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+            CHECK(brgemm_kernel_get_or_create(
+                    brg_kernels_[idx], pd()->brg_descs_[idx]));
             if (jbgp.is_amx)
                 brgemm_palettes_.insert(idx, pd()->brg_descs_[idx]);
 
@@ -630,7 +627,7 @@ private:
     using ker_diff_bias_t = jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
     std::unique_ptr<ker_diff_bias_t> kernels_db_[2][2];
-    std::unique_ptr<brgemm_kernel_t>
+    std::shared_ptr<const brgemm_kernel_t>
             brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
     std::unique_ptr<jit_brgemm_trans_src_t> trans_A_kernel_;
     std::unique_ptr<jit_brgemm_trans_to_vnni_t> trans_B_kernel_;
@@ -22,6 +22,7 @@
 
 #include "common/bit_cast.hpp"
 #include "common/compiler_workarounds.hpp"
+#include "common/memory_usage.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -2763,7 +2764,10 @@ public:
                   /*allocator=*/this)
         , max_cpu_isa_(max_cpu_isa) {}
 
-    ~jit_generator_t() override = default;
+    ~jit_generator_t() override {
+        memory_usage::sub(
+                memory_usage::kind_t::jit_code, engine_kind::cpu, code_size_);
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -2803,6 +2807,11 @@ private:
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
         register_jit_code(code, getSize());
+        if (code_size_ == 0) {
+            code_size_ = getSize();
+            memory_usage::add(memory_usage::kind_t::jit_code,
+                    engine_kind::cpu, code_size_);
+        }
         return code;
     }
 
@@ -2811,6 +2820,8 @@ private:
     }
 
     static constexpr unsigned max_code_size = 256 * 1024;
+    // Size of the generated code reported to the memory usage accounting.
+    size_t code_size_ = 0;
 
 protected:
     virtual void generate() = 0;
@@ -620,9 +620,10 @@ void jit_uni_binary_t::pd_t::init_scratchpad() {
     }
 }
 
-binary_kernel_t *create_binary_kernel(
-        const jit_uni_binary_t::pd_t *pd, bool tail_kernel) {
-    const auto &conf = pd->get_conf();
+binary_kernel_t *create_binary_kernel(const jit_uni_binary_t::pd_t *pd,
+        bool tail_kernel, bool nt_stores = false) {
+    auto conf = pd->get_conf();
+    conf.use_nt_stores = nt_stores;
     const memory_desc_wrapper src0_d(pd->src_md(0));
     // No support for different blocked memory layouts
     const auto blk_size = src0_d.blocking_desc().inner_blks[0];
@@ -765,6 +766,19 @@ status_t jit_uni_binary_t::init(engine_t *engine) {
         }
     }
 
+    // Streaming stores are only used by the no broadcast strategy, which
+    // splits the destination between threads in full vectors.
+    const auto &conf = pd()->get_conf();
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    if (utils::one_of(conf.bcast_type, bcast_t::none, bcast_t::scalar)
+            && !conf.is_src_different_layouts
+            && io::use_nt_stores(pd()->attr(), dst_d.size())) {
+        CHECK(safe_ptr_assign(kernel_nt_,
+                create_binary_kernel(
+                        pd(), false /*tail_kernel*/, true /*nt_stores*/)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+
     return kernel_->create_kernel();
 }
 
@@ -773,7 +787,12 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
         const void *src0_scales, const void *src1_scales,
         const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
         const bcast_t bcast_type) const {
-    const auto kernel = kernel_.get();
+    // The kernel with streaming stores is created only when the source
+    // layouts are the same. Every thread starts at a full vector then, so
+    // the stores are aligned when the destination is.
+    const bool is_dst_aligned = reinterpret_cast<uintptr_t>(dst) % 64 == 0;
+    const auto kernel = kernel_nt_ && is_dst_aligned ? kernel_nt_.get()
+                                                     : kernel_.get();
     const auto &simd_w = kernel_->simd_w();
 
     const memory_desc_wrapper src0_d(pd()->src_md(0));
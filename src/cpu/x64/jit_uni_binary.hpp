@@ -108,6 +108,8 @@ private:
     std::unique_ptr<binary_kernel_t> kernel_;
     // used only in bcast_c_blocked strategy if tail exists
     std::unique_ptr<binary_kernel_t> kernel_tail_;
+    // used only in no_bcast strategy for large destinations
+    std::unique_ptr<binary_kernel_t> kernel_nt_;
 };
 
 } // namespace x64
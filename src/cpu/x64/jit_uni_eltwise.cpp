@@ -80,13 +80,14 @@ template <cpu_isa_t isa>
 struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
 
-    jit_uni_kernel_t(const eltwise_pd_t *pd)
+    jit_uni_kernel_t(const eltwise_pd_t *pd, bool nt_stores = false)
         : jit_uni_eltwise_kernel_t(pd, jit_name(), isa)
         , vlen_(is_bf16() || is_f16() ? cpu_isa_traits_t<isa>::vlen / 2
                           : is_f8()   ? cpu_isa_traits_t<isa>::vlen / 4
                                       : cpu_isa_traits_t<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , nt_stores_(nt_stores) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
@@ -96,8 +97,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         eltwise_injector_.reset(new jit_uni_eltwise_injector_t<injector_isa>(
                 this, desc.alg_kind, desc.alpha, desc.beta, 1.f, data_type::f32,
                 save_state, reg_injector_table, injector_mask, is_fwd_,
-                pd_->use_dst()));
-        io::io_conf_t io_conf;
+                pd_->use_dst(), true, true,
+                eltwise_injector::is_fast_approx_allowed(pd_->attr())));
+        io::io_conf_t io_conf(nt_stores_);
         io::io_tail_conf_t io_tail_conf(simd_w_, tail_size_, tail_opmask_idx_,
                 vmm_tail_mask.getIdx(), reg_tmp);
         io::io_emu_bf16_conf_t io_bf16_conf(emu_zmm_1_idx_, emu_zmm_2_idx_,
@@ -224,6 +226,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
         compute();
+        // Make the streaming stores globally visible before returning.
+        if (nt_stores_) sfence();
 
         postamble();
 
@@ -239,6 +243,7 @@ private:
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    const bool nt_stores_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
@@ -333,7 +338,15 @@ jit_uni_eltwise_fwd_t<isa>::~jit_uni_eltwise_fwd_t() = default;
 template <cpu_isa_t isa>
 status_t jit_uni_eltwise_fwd_t<isa>::init(engine_t *engine) {
     CHECK(safe_ptr_assign(kernel_, new jit_uni_kernel_t<isa>(pd())));
-    return kernel_->create_kernel();
+    CHECK(kernel_->create_kernel());
+
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    if (io::use_nt_stores(pd()->attr(), dst_d.size())) {
+        CHECK(safe_ptr_assign(
+                kernel_nt_, new jit_uni_kernel_t<isa>(pd(), true)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+    return status::success;
 }
 
 template <cpu_isa_t isa>
@@ -348,6 +361,13 @@ status_t jit_uni_eltwise_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     src += data_d.data_type_size() * data_d.offset0();
     dst += data_d.data_type_size() * data_d.offset0();
 
+    // Work is split between threads in chunks of 64 bytes, so every thread
+    // writes to an aligned address when the destination is aligned. The
+    // alignment of user-provided buffers is only known at execution time.
+    const bool is_dst_aligned = reinterpret_cast<uintptr_t>(dst) % 64 == 0;
+    auto *kernel = kernel_nt_ && is_dst_aligned ? kernel_nt_.get()
+                                                : kernel_.get();
+
     parallel(0, [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
@@ -361,7 +381,7 @@ status_t jit_uni_eltwise_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         args.dst = dst + data_d.data_type_size() * start;
         args.diff_dst = nullptr;
         args.work_amount = end - start;
-        (*kernel_)(&args);
+        (*kernel)(&args);
     });
 
     return status::success;
@@ -57,6 +57,8 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<jit_uni_eltwise_kernel_t> kernel_;
+    // Kernel with non-temporal stores, created for large destinations.
+    std::unique_ptr<jit_uni_eltwise_kernel_t> kernel_nt_;
 };
 
 template <cpu_isa_t isa>
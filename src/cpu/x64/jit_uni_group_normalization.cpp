@@ -14,9 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 
+#include "cpu/cpu_normalization_utils.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -392,10 +397,14 @@ struct kernel_stat_t
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_group_normalization_fwd_t::kernel_stat_t);
 
-    kernel_stat_t(const group_normalization_pd_t *pd, bool compute_var = false)
+    using stat_kind_t = jit_uni_group_normalization_fwd_t::stat_kind_t;
+
+    kernel_stat_t(const group_normalization_pd_t *pd, stat_kind_t kind)
         : jit_generator_t(jit_name())
         , src_d_(pd->src_md())
-        , compute_var_(compute_var)
+        , kind_(kind)
+        , compute_mean_(kind != stat_kind_t::var)
+        , compute_var_(kind != stat_kind_t::mean)
         , C_(pd->C())
         , C_PER_G_(C_ / pd->G())
         , SP_(pd->D() * pd->H() * pd->W())
@@ -425,13 +434,13 @@ struct kernel_stat_t
                 this, io_isa, {f32}, io_conf, io_tail_conf_stats);
 
         VDEBUGINFO(1, primitive, group_normalization,
-                "%s:\n    compute_var_=%d\n    C_=%" PRId64
+                "%s:\n    kind_=%d\n    C_=%" PRId64
                 "\n    C_PER_G_=%" PRId64
                 "\n    simd_w_=%zu\n    axis_simd_tail_=%" PRId64
                 "\n    unroll_c_=%" PRId64 "\n    c_block_=%" PRId64
                 "\n    nc_blocks_=%" PRId64 "\n    c_block_tail_=%" PRId64
                 "\n    unroll_c_tail_=%" PRId64,
-                jit_name(), compute_var_, C_, C_PER_G_, simd_w_,
+                jit_name(), static_cast<int>(kind_), C_, C_PER_G_, simd_w_,
                 axis_simd_tail_, unroll_c_, c_block_, nc_blocks_, c_block_tail_,
                 unroll_c_tail_);
     }
@@ -460,15 +469,13 @@ struct kernel_stat_t
                 : unroll_c_tail_             ? unroll_c_tail_
                                              : 1;
 
-        if (!compute_var_) {
-            for (size_t ur = 0; ur < max_unroll; ur++) {
+        for (size_t ur = 0; ur < max_unroll; ur++) {
+            if (compute_mean_)
                 uni_vpxor(Vmm_mean(ur), Vmm_mean(ur), Vmm_mean(ur));
-            }
-        } else {
-            for (size_t ur = 0; ur < max_unroll; ur++) {
-                uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
-            }
+            if (compute_var_) uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
         }
+        if (kind_ == stat_kind_t::shifted_sums)
+            io_[data_type::f32]->broadcast(mean_ptr(0), vmm_mean);
 
         if (nc_blocks_) {
             xor_(reg_nc_block, reg_nc_block);
@@ -502,35 +509,22 @@ struct kernel_stat_t
         // Reduction on registers for Group normalization as the kernel
         // processes a single group at a time.
 
-        // Part 1 is reducing over unrolled registers.
-        const Vmm &vmm_stat = !compute_var_ ? vmm_mean : vmm_var;
+        if (kind_ == stat_kind_t::shifted_sums) {
+            // The sums are not normalized, the caller merges them over
+            // several calls and computes the statistics.
+            reduce(vmm_mean, false, max_unroll);
+            reduce(vmm_var, true, max_unroll);
 
-        Vmm vmm_tmp_max0 = !compute_var_ ? Vmm_mean(0) : Vmm_var(0);
-        Vmm vmm_tmp_max1 = !compute_var_ ? Vmm_mean(1) : Vmm_var(1);
-        Vmm vmm_tmp_max2 = !compute_var_ ? Vmm_mean(2) : Vmm_var(2);
-        Vmm vmm_tmp_max3 = !compute_var_ ? Vmm_mean(3) : Vmm_var(3);
+            io_stat_.prepare_tail_mask();
+            io_stat_[f32]->store(vmm_mean, var_ptr(0), true);
+            io_stat_[f32]->store(vmm_var, var_ptr(1), true);
 
-        switch (max_unroll) {
-            case 4: {
-                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
-                uni_vaddps(vmm_tmp_max2, vmm_tmp_max2, vmm_tmp_max3);
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
-            } break;
-            case 3: {
-                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max2);
-            } break;
-            case 2: {
-                uni_vaddps(vmm_stat, vmm_tmp_max0, vmm_tmp_max1);
-            } break;
-            case 1: {
-                uni_vmovups(vmm_stat, vmm_tmp_max0);
-            } break;
-            default: break;
+            postamble();
+            return;
         }
 
-        // Part 2 is to reduce within a single register.
-        reduce_horizontal(vmm_stat, vmm_tmp);
+        const Vmm &vmm_stat = !compute_var_ ? vmm_mean : vmm_var;
+        reduce(vmm_stat, compute_var_, max_unroll);
 
         // Divide a stat by N.
         // Note: the behavior is aligned with with kernel execution model.
@@ -587,6 +581,8 @@ protected:
     };
 
     const memory_desc_wrapper src_d_;
+    const stat_kind_t kind_;
+    const bool compute_mean_;
     const bool compute_var_;
     const dim_t C_;
     const dim_t C_PER_G_;
@@ -603,6 +599,38 @@ protected:
     // `io_stat_` is to store a single element of mean or var.
     io::jit_io_multi_dt_helper_t<Vmm> io_stat_;
 
+    // Reduces unrolled mean or var accumulators into a single value in
+    // `vstat`.
+    void reduce(const Vmm &vstat, bool var_regs, size_t max_unroll) {
+        // Part 1 is reducing over unrolled registers.
+        Vmm vmm_tmp_max0 = !var_regs ? Vmm_mean(0) : Vmm_var(0);
+        Vmm vmm_tmp_max1 = !var_regs ? Vmm_mean(1) : Vmm_var(1);
+        Vmm vmm_tmp_max2 = !var_regs ? Vmm_mean(2) : Vmm_var(2);
+        Vmm vmm_tmp_max3 = !var_regs ? Vmm_mean(3) : Vmm_var(3);
+
+        switch (max_unroll) {
+            case 4: {
+                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
+                uni_vaddps(vmm_tmp_max2, vmm_tmp_max2, vmm_tmp_max3);
+                uni_vaddps(vstat, vmm_tmp_max0, vmm_tmp_max2);
+            } break;
+            case 3: {
+                uni_vaddps(vmm_tmp_max0, vmm_tmp_max0, vmm_tmp_max1);
+                uni_vaddps(vstat, vmm_tmp_max0, vmm_tmp_max2);
+            } break;
+            case 2: {
+                uni_vaddps(vstat, vmm_tmp_max0, vmm_tmp_max1);
+            } break;
+            case 1: {
+                uni_vmovups(vstat, vmm_tmp_max0);
+            } break;
+            default: break;
+        }
+
+        // Part 2 is to reduce within a single register.
+        reduce_horizontal(vstat, vmm_tmp);
+    }
+
     void reduce_horizontal(const Vmm &vstat, const Vmm &vtmp) {
         if (is_superset(isa, avx512_core)) {
             const Zmm &zstat = Zmm(vstat.getIdx());
@@ -709,11 +737,61 @@ protected:
         }
         L(sp_blk_loop_end);
     }
+
+    // Accumulates `src - shift` and its square, the shift is in `vmm_mean`.
+    void compute_sums_block(size_t unroll, bool tail = false) {
+        const size_t c_src_size
+                = C_ * types::data_type_size(src_d_.data_type());
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+
+        mov(reg_src, reg_src_start);
+        // add block_start to block_size to define block_end
+        add(reg_sp_block_end, reg_src);
+
+        if (tail && !is_superset(isa, avx512_core)) {
+            // Zero the shift where there's no data, see `compute_var_block`.
+            uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
+            uni_vblendvps(vmm_mean, vmm_tmp, vmm_mean, vmm_tail_mask);
+        }
+
+        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
+        L(sp_blk_loop);
+        {
+            cmp(reg_sp_block_end, reg_src);
+            jle(sp_blk_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++) {
+                io_[src_d_.data_type()]->load(
+                        src_ptr(ur * simd_w_), Vmm_src(ur), tail);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                if (tail && is_superset(isa, avx512_core))
+                    uni_vsubps(
+                            Vmm_src(ur) | tail_opmask, Vmm_src(ur), vmm_mean);
+                else
+                    uni_vsubps(Vmm_src(ur), Vmm_src(ur), vmm_mean);
+            }
+            for (size_t ur = 0; ur < unroll; ur++) {
+                uni_vaddps(Vmm_mean(ur), Vmm_mean(ur), Vmm_src(ur));
+                uni_vfmadd231ps(Vmm_var(ur), Vmm_src(ur), Vmm_src(ur));
+            }
+
+            add(reg_src, c_src_size);
+            jmp(sp_blk_loop);
+        }
+        L(sp_blk_loop_end);
+    }
+
     void compute_stat_block(size_t unroll, bool tail = false) {
-        if (compute_var_)
-            compute_var_block(unroll, tail);
-        else
-            compute_mean_block(unroll, tail);
+        switch (kind_) {
+            case stat_kind_t::mean: compute_mean_block(unroll, tail); break;
+            case stat_kind_t::var: compute_var_block(unroll, tail); break;
+            case stat_kind_t::shifted_sums:
+                compute_sums_block(unroll, tail);
+                break;
+        }
     }
 
     Vmm Vmm_mean(size_t ur = 0) { return Vmm(1 + 0 * unroll_c_ + ur); }
@@ -776,11 +854,11 @@ jit_uni_group_normalization_fwd_t::kernel_base_t::create(
 
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(
-        const group_normalization_pd_t *apd, bool compute_var) {
+        const group_normalization_pd_t *apd, stat_kind_t kind) {
     if (mayiuse(avx512_core)) {
-        return new kernel_stat_t<avx512_core>(apd, compute_var);
+        return new kernel_stat_t<avx512_core>(apd, kind);
     } else if (mayiuse(avx2)) {
-        return new kernel_stat_t<avx2>(apd, compute_var);
+        return new kernel_stat_t<avx2>(apd, kind);
     } else {
         assert(!"kernel is empty.");
         return nullptr;
@@ -853,7 +931,10 @@ status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
         // C() is used here for convenience, to let C++ reduce over the group.
         // TODO: replace with G() instead and make reduction in registers.
         const size_t stats_size = MB() * C();
-        const size_t stats_reduction_buf_sz = stats_size * nthr_;
+        // Single-pass statistics need two sums per chunk and a shift per
+        // group.
+        const size_t stats_reduction_buf_sz
+                = nstl::max(stats_size, size_t(MB() * G() * 3)) * nthr_;
         scratchpad.template book<float>(
                 key_gnorm_reduction, stats_reduction_buf_sz);
         if (!is_training()) {
@@ -965,8 +1046,19 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
                 float *var_ptr = variance + i;
 
                 if (calculate_stats) {
-                    (*kernel_mean_)(src_ptr, mean_ptr, SP);
-                    (*kernel_var_)(src_ptr, mean_ptr, var_ptr, SP);
+                    // The statistics are computed in a single pass with the
+                    // first value of the group as the shift. The two-pass
+                    // algorithm is used when the result is not accurate.
+                    const float sums_shift = cpu::io::load_float_value(
+                            src_d.data_type(), src_ptr, 0);
+                    float sums[2];
+                    (*kernel_sums_)(src_ptr, &sums_shift, sums, SP);
+                    if (!normalization_utils::stats_from_shifted_sums(
+                                C_PER_G * SP, sums_shift, sums[0], sums[1],
+                                *mean_ptr, *var_ptr)) {
+                        (*kernel_mean_)(src_ptr, mean_ptr, SP);
+                        (*kernel_var_)(src_ptr, mean_ptr, var_ptr, SP);
+                    }
                 }
                 (*kernel_)(src_ptr, dst_ptr, scale_ptr, shift_ptr, mean_ptr,
                         var_ptr, src_scales, dst_scales_inv_ptr,
@@ -994,7 +1086,74 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
             });
         };
 
+        // Single-pass statistics: all chunks of a group share the shift, the
+        // first value of the group, so their sums are merged by summation.
+        // If any group fails the accuracy check, the statistics are computed
+        // with the two-pass algorithm below.
+        bool two_pass_stats = false;
         if (calculate_stats) {
+            float *sums_shift = stat_reduction + 2 * G * N * nthr_per_g;
+            parallel_nd(N, G, [&](dim_t n, dim_t g) {
+                const size_t data_off
+                        = (size_t)n * C_padded * SP + g * C_PER_G;
+                sums_shift[n * G + g] = cpu::io::load_float_value(
+                        src_d.data_type(), src, data_off);
+            });
+
+            parallel(nthr,
+                    [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
+                dim_t chunk_start = 0, chunk_end = 0;
+                balance211(
+                        G * N * nthr_per_g, nthr, ithr, chunk_start, chunk_end);
+                if (chunk_start == chunk_end) return;
+
+                dim_t g_per_n = G * nthr_per_g;
+                dim_t SP_chunk = SP / nthr_per_g;
+
+                for (dim_t i = chunk_start; i < chunk_end; i++) {
+                    dim_t ithr_stride_n = (i / g_per_n) * C_padded * SP;
+                    dim_t ithr_stride_g = (i % G) * C_PER_G;
+                    dim_t ithr_stride_sp
+                            = ((i % g_per_n) / G) * C_padded * SP_chunk;
+                    const size_t data_off = (size_t)ithr_stride_n
+                            + ithr_stride_g + ithr_stride_sp;
+                    const char *__restrict src_ptr
+                            = static_cast<const char *>(src)
+                            + data_off * src_d.data_type_size();
+
+                    const float *shift_ptr
+                            = sums_shift + (i % G) + (i / g_per_n) * G;
+                    float *sums_ptr = stat_reduction + 2 * i;
+
+                    dim_t SP_tail_chunk = SP - ((i % g_per_n) / G) * SP_chunk;
+                    dim_t kernel_sp_block_size
+                            = (((i % g_per_n) / G) == nthr_per_g - 1)
+                            ? SP_tail_chunk
+                            : SP_chunk;
+                    (*kernel_sums_)(
+                            src_ptr, shift_ptr, sums_ptr, kernel_sp_block_size);
+                }
+            });
+
+            std::vector<char> is_stable(G * N);
+            parallel_nd(N, G, [&](dim_t n, dim_t g) {
+                double s1 = 0, s2 = 0;
+                for (dim_t ithr = 0; ithr < nthr_per_g; ithr++) {
+                    const float *sums_ptr = stat_reduction
+                            + 2 * (n * nthr_per_g * G + ithr * G + g);
+                    s1 += sums_ptr[0];
+                    s2 += sums_ptr[1];
+                }
+                is_stable[n * G + g]
+                        = normalization_utils::stats_from_shifted_sums(
+                                C_PER_G * SP, sums_shift[n * G + g], s1, s2,
+                                mean[n * G + g], variance[n * G + g]);
+            });
+            two_pass_stats = std::any_of(is_stable.begin(), is_stable.end(),
+                    [](char stable) { return !stable; });
+        }
+
+        if (two_pass_stats) {
             parallel(nthr,
                     [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
                 dim_t chunk_start = 0, chunk_end = 0;
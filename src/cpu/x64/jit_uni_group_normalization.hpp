@@ -44,12 +44,16 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
 
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
-        CHECK(safe_ptr_assign(kernel_mean_, kernel_stat_base_t::create(pd())));
-        CHECK(safe_ptr_assign(
-                kernel_var_, kernel_stat_base_t::create(pd(), true)));
+        CHECK(safe_ptr_assign(kernel_mean_,
+                kernel_stat_base_t::create(pd(), stat_kind_t::mean)));
+        CHECK(safe_ptr_assign(kernel_var_,
+                kernel_stat_base_t::create(pd(), stat_kind_t::var)));
+        CHECK(safe_ptr_assign(kernel_sums_,
+                kernel_stat_base_t::create(pd(), stat_kind_t::shifted_sums)));
         if (kernel_) CHECK(kernel_->create_kernel());
         if (kernel_mean_) CHECK(kernel_mean_->create_kernel());
         if (kernel_var_) CHECK(kernel_var_->create_kernel());
+        if (kernel_sums_) CHECK(kernel_sums_->create_kernel());
         return status::success;
     }
 
@@ -76,6 +80,12 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
         const group_normalization_pd_t *pd_;
     };
 
+    // `mean` computes the mean of a group, `var` computes the variance given
+    // the mean. `shifted_sums` computes the sum of `src - shift` and the sum
+    // of its squares in a single pass, see `stats_from_shifted_sums`. The
+    // shift is passed as `mean` and the two sums are stored to `var`.
+    enum class stat_kind_t { mean, var, shifted_sums };
+
     struct kernel_stat_base_t {
         virtual void operator()(
                 const void *src, float *mean, size_t block_size) const
@@ -84,7 +94,7 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
                 size_t block_size) const
                 = 0;
         static kernel_stat_base_t *create(
-                const group_normalization_pd_t *pd, bool compute_var = false);
+                const group_normalization_pd_t *pd, stat_kind_t kind);
         virtual status_t create_kernel() = 0;
         virtual ~kernel_stat_base_t() = default;
     };
@@ -96,6 +106,7 @@ protected:
     std::unique_ptr<kernel_base_t> kernel_;
     std::unique_ptr<kernel_stat_base_t> kernel_mean_;
     std::unique_ptr<kernel_stat_base_t> kernel_var_;
+    std::unique_ptr<kernel_stat_base_t> kernel_sums_;
 };
 
 } // namespace x64
@@ -85,10 +85,13 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
     void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var, const void *src_scales,
             const void *dst_scales, const void *post_ops_binary_rhs_arg_vec,
-            const size_t block_size) const override {
+            const size_t block_size, const void *residual,
+            void *residual_dst) const override {
         ker_args_t args;
         args.src = src;
         args.dst = dst;
+        args.residual = residual;
+        args.residual_dst = residual_dst;
         args.scale = scale;
         args.shift = shift;
         args.mean = mean;
@@ -120,9 +123,12 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
         , eps_(pd_->desc()->layer_norm_epsilon)
+        , use_residual_(pd_->use_residual())
+        , output_residual_(pd_->output_residual())
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(
-                          src_d_.data_type(), data_type::f16, data_type::bf16))
+                          src_d_.data_type(), data_type::f16, data_type::bf16)
+                  && !use_residual_)
         , skip_mean_(pd_->skip_mean()) {
 
         const auto &post_ops = pd_->attr()->post_ops_;
@@ -162,6 +168,8 @@ protected:
     struct ker_args_t {
         const void *src;
         void *dst;
+        const void *residual;
+        void *residual_dst;
         const float *scale;
         const float *shift;
         const float *mean;
@@ -184,6 +192,8 @@ protected:
     const bool save_stats_;
     const bool calculate_stats_;
     const float eps_;
+    const bool use_residual_;
+    const bool output_residual_;
     const bool has_ne_convert_src_xf16_;
     const bool skip_mean_;
     bool with_postops_ = false;
@@ -207,6 +217,8 @@ protected:
     const Reg64 reg_var = r13;
     const Reg64 reg_src_scales = r14;
     const Reg64 reg_dst_scales = r15;
+    const Reg64 reg_residual = rsi;
+    const Reg64 reg_residual_dst = rbp;
 
     const Vmm vmm_tail_mask = Vmm(0);
     const Vmm vmm_zero = Vmm(4); // In unroll range, safe for dst compute.
@@ -245,6 +257,14 @@ protected:
         return vmmword[reg_dst + offt * dst_d_.data_type_size()];
     }
 
+    Address residual_ptr(size_t offt = 0) {
+        return vmmword[reg_residual + offt * src_d_.data_type_size()];
+    }
+
+    Address residual_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_residual_dst + offt * src_d_.data_type_size()];
+    }
+
     Address mean_ptr(size_t offt = 0) {
         return vmmword[reg_mean + offt * sizeof(float)];
     }
@@ -263,6 +283,16 @@ protected:
 
     virtual void reduce(Vmm vmm_src, Vmm vmm_tmp) = 0;
 
+    // Loads the normalized values: the source, or its sum with the residual.
+    // Clobbers `vmm_tmp` when the residual is used.
+    void load_src(size_t offt_elems, const Vmm &vmm_src, bool tail) {
+        io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
+        if (!use_residual_) return;
+        io_[src_d_.data_type()]->load(
+                residual_ptr(offt_elems), vmm_tmp, tail);
+        uni_vaddps(vmm_src, vmm_src, vmm_tmp);
+    }
+
     void uni_vsubps_maybe_tail(const Vmm &x1, const Vmm &x2, const bool tail) {
         // Need to preserve zeros after subtract for correct answer.
         if (!tail)
@@ -364,8 +394,7 @@ protected:
             // unrolled loop
             for (int i = 0; i < axis_simd_full_ / unroll; i++)
                 for (int j = base_idx; j < base_idx + unroll; j++) {
-                    io_[src_d_.data_type()]->load(
-                            src_ptr((i * unroll + j - base_idx) * simd_w_),
+                    load_src((i * unroll + j - base_idx) * simd_w_,
                             Vmm(j + unroll), need_tail);
                     op(Vmm(j), Vmm(j + unroll), need_tail);
                 }
@@ -381,8 +410,7 @@ protected:
             // unrolled loop remainder
             for (int i = utils::rnd_dn(axis_simd_full_, unroll);
                     i < axis_simd_full_; i++) {
-                io_[src_d_.data_type()]->load(
-                        src_ptr(i * simd_w_), Vmm(base_idx + 1), need_tail);
+                load_src(i * simd_w_, Vmm(base_idx + 1), need_tail);
                 op(Vmm(base_idx), Vmm(base_idx + 1), need_tail);
             }
         }
@@ -390,8 +418,7 @@ protected:
         if (axis_simd_tail_ > 0) {
             need_tail = true;
             // vector remainder
-            io_[src_d_.data_type()]->load(src_ptr(axis_simd_full_ * simd_w_),
-                    Vmm(base_idx + 1), need_tail);
+            load_src(axis_simd_full_ * simd_w_, Vmm(base_idx + 1), need_tail);
             op(Vmm(base_idx), Vmm(base_idx + 1), need_tail);
         }
 
@@ -488,7 +515,13 @@ protected:
         if (use_shift_) {
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
-        io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
+        load_src(offt_elems, vmm_dst, tail);
+        if (output_residual_) {
+            // Stores may convert the register in place.
+            uni_vmovups(vmm_tmp, vmm_dst);
+            io_[src_d_.data_type()]->store(
+                    vmm_tmp, residual_dst_ptr(offt_elems), tail);
+        }
         if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
@@ -576,6 +609,10 @@ protected:
 
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
         mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        if (use_residual_)
+            mov(reg_residual, ptr[reg_param + PARAM_OFF(residual)]);
+        if (output_residual_)
+            mov(reg_residual_dst, ptr[reg_param + PARAM_OFF(residual_dst)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(scale)]);
         mov(reg_shift, ptr[reg_param + PARAM_OFF(shift)]);
         mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
@@ -634,6 +671,8 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_dst, c_dst_size);
+            if (use_residual_) add(reg_residual, c_src_size);
+            if (output_residual_) add(reg_residual_dst, c_src_size);
             add(reg_mean, float_size);
             add(reg_var, float_size);
             jmp(unroll_loop);
@@ -1234,6 +1273,10 @@ status_t jit_uni_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
                             mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2)),
             VERBOSE_ISA_DT_MISMATCH);
     VDISPATCH_LNORM(stat_md()->data_type == f32, VERBOSE_UNSUPPORTED_DT);
+    // The sum with the residual is stored without saturation.
+    VDISPATCH_LNORM(IMPLICATION(use_residual(),
+                            utils::one_of(src_md()->data_type, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_LNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_FEATURE,
             "unsupported scale or shift data type");
     VDISPATCH_LNORM(attr()->has_default_values(
@@ -1286,6 +1329,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
     const auto &scratchpad = ctx.get_scratchpad_grantor();
     const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const auto residual = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto residual_dst = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
 
     auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
@@ -1331,6 +1376,13 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
                 + N_start * C_padded * src_d.data_type_size();
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
+        const size_t src_offt = N_start * C_padded * src_d.data_type_size();
+        const char *residual_ptr = residual
+                ? reinterpret_cast<const char *>(residual) + src_offt
+                : nullptr;
+        char *residual_dst_ptr = residual_dst
+                ? reinterpret_cast<char *>(residual_dst) + src_offt
+                : nullptr;
         const int block_size = N_end - N_start;
         float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
         float *dst_scales_inv_ptr = nullptr;
@@ -1345,7 +1397,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
 
         (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
                 &variance[N_start], src_scales, dst_scales_inv_ptr,
-                post_ops_binary_rhs_arg_vec.data(), block_size);
+                post_ops_binary_rhs_arg_vec.data(), block_size, residual_ptr,
+                residual_dst_ptr);
     });
     return status::success;
 }
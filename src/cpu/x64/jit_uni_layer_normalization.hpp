@@ -43,7 +43,8 @@ struct stat_and_data_kernel_t {
     virtual void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var, const void *src_scales,
             const void *dst_scales, const void *post_ops_binary_rhs_arg_vec,
-            const size_t block_size) const {};
+            const size_t block_size, const void *residual = nullptr,
+            void *residual_dst = nullptr) const {};
 
     virtual status_t create_kernel() { return status::success; }
 
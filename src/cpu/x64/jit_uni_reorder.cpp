@@ -1843,7 +1843,10 @@ struct jit_single_blk_kernel_t : public jit_generator_t {
             gen_ker8x8(0, 0, input_stride, output_stride, 8, 8);
             block_sz = 8;
         } else if (block_sz == 16) {
-            gen_ker16x16_in_8x8(input_stride, output_stride);
+            if (mayiuse(avx512_core))
+                gen_ker16x16_avx512(input_stride, output_stride);
+            else
+                gen_ker16x16_in_8x8(input_stride, output_stride);
             block_sz = 16;
         } else {
             assert(!"unimplemented");
@@ -2013,6 +2016,52 @@ struct jit_single_blk_kernel_t : public jit_generator_t {
                 output_stride, sub_lane, sub_lane);
     }
 
+    // Transposes 16x16 block of 32-bit elements. The rows are loaded into
+    // zmm16~31, zmm0~15 hold the intermediate results.
+    void gen_transpose_16x16_avx512() {
+        constexpr int lane = 16;
+        auto r = [](int i) { return Zmm(16 + i); };
+        auto t = [](int i) { return Zmm(i); };
+
+        // Interleave pairs of rows
+        for (int i = 0; i < lane / 2; i++) {
+            vunpcklps(t(2 * i), r(2 * i), r(2 * i + 1));
+            vunpckhps(t(2 * i + 1), r(2 * i), r(2 * i + 1));
+        }
+        // Transpose 4x4 blocks within 128-bit lanes: r(4 * i + k) gets
+        // column `k` of each lane for rows 4 * i ~ 4 * i + 3.
+        for (int i = 0; i < lane / 4; i++) {
+            vunpcklpd(r(4 * i + 0), t(4 * i + 0), t(4 * i + 2));
+            vunpckhpd(r(4 * i + 1), t(4 * i + 0), t(4 * i + 2));
+            vunpcklpd(r(4 * i + 2), t(4 * i + 1), t(4 * i + 3));
+            vunpckhpd(r(4 * i + 3), t(4 * i + 1), t(4 * i + 3));
+        }
+        // Transpose 128-bit lanes of r(k), r(4 + k), r(8 + k), r(12 + k)
+        for (int k = 0; k < 4; k++) {
+            vshuff32x4(t(4 * k + 0), r(k), r(4 + k), 0x44);
+            vshuff32x4(t(4 * k + 1), r(k), r(4 + k), 0xee);
+            vshuff32x4(t(4 * k + 2), r(8 + k), r(12 + k), 0x44);
+            vshuff32x4(t(4 * k + 3), r(8 + k), r(12 + k), 0xee);
+            vshuff32x4(r(k), t(4 * k + 0), t(4 * k + 2), 0x88);
+            vshuff32x4(r(4 + k), t(4 * k + 0), t(4 * k + 2), 0xdd);
+            vshuff32x4(r(8 + k), t(4 * k + 1), t(4 * k + 3), 0x88);
+            vshuff32x4(r(12 + k), t(4 * k + 1), t(4 * k + 3), 0xdd);
+        }
+    }
+
+    void gen_ker16x16_avx512(int input_stride, int output_stride) {
+        constexpr int lane = 16;
+        for (int i = 0; i < lane; ++i)
+            vmovups(Zmm(16 + i),
+                    ptr[reg_ptr_in_ + i * input_stride * itype_sz_]);
+
+        gen_transpose_16x16_avx512();
+
+        for (int i = 0; i < lane; ++i)
+            vmovups(ptr[reg_ptr_out_ + i * output_stride * otype_sz_],
+                    Zmm(16 + i));
+    }
+
     // tail can be 1 ~ 16, using avx2 for now
     void gen_ker16x16_in_8x8(
             int input_stride, int output_stride, int in_tail, int out_tail) {
@@ -2047,8 +2096,8 @@ struct jit_single_blk_kernel_t : public jit_generator_t {
     }
 
 private:
-    // 6 ~ 12
-    constexpr static int xmm_save_for_windows = is_windows ? 7 : 0;
+    // 6 ~ 15
+    constexpr static int xmm_save_for_windows = is_windows ? 10 : 0;
     constexpr static int xmm_save_start_from = 6;
     constexpr static int xmm_width = 16;
 
@@ -939,10 +939,13 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     // that are participated are not defined at the moment of base ctor
     // initialization.
     void generate() override {
+        const bool fast_approx = pd_->is_fwd()
+                && eltwise_injector::is_fast_approx_allowed(pd_->attr());
         if (pd_->is_fwd() || is_logsoftmax_)
             exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
-                    !use_ext_aux_vmms_, reg_exp_injector_table, injector_mask));
+                    !use_ext_aux_vmms_, reg_exp_injector_table, injector_mask,
+                    true, false, true, true, fast_approx));
         if (pd_->is_fwd() && is_logsoftmax_) {
             log_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_log, 0.0f, 0.0f, 1.0f, data_type::f32,
@@ -1524,10 +1527,13 @@ struct jit_softmax_strided_kernel_t : jit_softmax_kernel_base_t,
     void forward() { inner_size_loop_unroll(); }
 
     void generate() override {
+        const bool fast_approx = pd_->is_fwd()
+                && eltwise_injector::is_fast_approx_allowed(pd_->attr());
         if (pd_->is_fwd() || is_logsoftmax_)
             exp_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, data_type::f32,
-                    true, reg_exp_injector_table, injector_mask));
+                    true, reg_exp_injector_table, injector_mask, true, false,
+                    true, true, fast_approx));
         if (pd_->is_fwd() && is_logsoftmax_) {
             log_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
                     alg_kind::eltwise_log, 0.0f, 0.0f, 1.0f, data_type::f32,
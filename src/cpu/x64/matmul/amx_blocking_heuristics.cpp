@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "cpu/x64/matmul/amx_blocking_heuristics.hpp"
 #include "cpu/matmul/gemm_based_common.hpp"
 
@@ -312,7 +314,8 @@ bool matmul_amx_blocking_params_macro_t::maybe_small_dims_heuristics(
 bool matmul_amx_blocking_params_macro_t::find_best_blocking(
         const brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
-        matmul_amx_blocking_params_macro_t &best_blocking) {
+        matmul_amx_blocking_params_macro_t &best_blocking,
+        std::vector<matmul_amx_blocking_params_macro_t> *candidates) {
 
     if (!matmul_amx_blocking_params_macro_t::is_supported(
                 bgmmc, bm_conf_utils)) {
@@ -323,7 +326,11 @@ bool matmul_amx_blocking_params_macro_t::find_best_blocking(
 
     matmul_amx_blocking_params_macro_t current_blocking(bgmmc);
 
-    if (maybe_small_dims_heuristics(bgmmc, best_blocking)) { return true; }
+    if (maybe_small_dims_heuristics(bgmmc, best_blocking)) {
+        if (candidates) candidates->assign(1, best_blocking);
+        return true;
+    }
+    if (candidates) candidates->clear();
 
     for (size_t nthr_to_check = bgmmc.nthr; nthr_to_check > 0;
             nthr_to_check--) {
@@ -346,6 +353,7 @@ bool matmul_amx_blocking_params_macro_t::find_best_blocking(
                     current_blocking.set_decomposition();
                     if (current_blocking.divs_are_acceptable()
                             && current_blocking.set_blocking_parameters()) {
+                        if (candidates) candidates->push_back(current_blocking);
                         if (current_blocking > best_blocking) {
                             best_blocking = current_blocking;
                         }
@@ -362,15 +370,28 @@ bool matmul_amx_blocking_params_macro_t::find_best_blocking(
         current_blocking.set_core_divs(best_blocking.nthr_b_,
                 best_blocking.nthr_m_, best_blocking.nthr_k_,
                 best_blocking.nthr_n_);
-        if (current_blocking.set_blocking_parameters(true)
-                && current_blocking > best_blocking) {
-            best_blocking = current_blocking;
+        if (current_blocking.set_blocking_parameters(true)) {
+            if (candidates) candidates->push_back(current_blocking);
+            if (current_blocking > best_blocking)
+                best_blocking = current_blocking;
         }
-        if (current_blocking.set_blocking_parameters(true, true)
-                && current_blocking > best_blocking) {
-            best_blocking = current_blocking;
+        if (current_blocking.set_blocking_parameters(true, true)) {
+            if (candidates) candidates->push_back(current_blocking);
+            if (current_blocking > best_blocking)
+                best_blocking = current_blocking;
         }
     }
+
+    if (candidates) {
+        // The heuristically best blocking goes first, the rest are ordered by
+        // their scores.
+        std::stable_sort(candidates->begin(), candidates->end(),
+                [](const matmul_amx_blocking_params_macro_t &a,
+                        const matmul_amx_blocking_params_macro_t &b) {
+                    return a.efficiency_score_ > b.efficiency_score_;
+                });
+        candidates->insert(candidates->begin(), best_blocking);
+    }
     return true;
 }
 
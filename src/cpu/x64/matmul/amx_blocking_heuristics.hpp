@@ -17,6 +17,8 @@
 #ifndef CPU_X64_MATMUL_AMX_BLOCKING_HEURISTICS_HPP
 #define CPU_X64_MATMUL_AMX_BLOCKING_HEURISTICS_HPP
 
+#include <vector>
+
 #include "common/math_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 
@@ -112,9 +114,13 @@ public:
     }
     static bool is_supported(const brgemm_matmul_conf_t &bgmmc,
             const brgemm_matmul_conf_utils_t &bm_conf_utils);
+    // If `candidates` is not null, it is filled with all acceptable blockings
+    // ordered by their scores, starting from the best one.
     static bool find_best_blocking(const brgemm_matmul_conf_t &bgmmc,
             const brgemm_matmul_conf_utils_t &bm_conf_utils,
-            matmul_amx_blocking_params_macro_t &best_blocking);
+            matmul_amx_blocking_params_macro_t &best_blocking,
+            std::vector<matmul_amx_blocking_params_macro_t> *candidates
+            = nullptr);
     static bool maybe_small_dims_heuristics(const brgemm_matmul_conf_t &bgmmc,
             matmul_amx_blocking_params_macro_t &best_blocking);
 
@@ -28,6 +28,7 @@
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_autotune.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -123,6 +124,115 @@ int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail,
 
 } // anonymous namespace
 
+void runtime_tail_plans_t::decompose(plan_t &plan, dim_t tail,
+        dim_t max_first_ker_size, dim_t blk, const int *tails, int ntails) {
+    plan.clear();
+    dim_t idx = 0;
+    int tail_idx = 0;
+    dim_t c_buf_idx = 0;
+    while (tail > 0) {
+        int tail_ker_size = tails[tail_idx];
+        int ker_idx = tail_idx + 1;
+        int prev_tail_ker_size = tail_idx > 0 ? tails[tail_idx - 1] : (int)blk;
+        bool last_tail_kernel = tail_idx == ntails - 1;
+        if (tail > tail_ker_size) {
+            const auto max_ker_size = plan.empty()
+                    ? max_first_ker_size
+                    : plan.back().kernel_size;
+            if (max_ker_size >= prev_tail_ker_size) {
+                tail_ker_size = prev_tail_ker_size;
+                ker_idx--;
+            }
+        } else if (tail < tail_ker_size && !last_tail_kernel) {
+            // skip this tail kernel, try the next one
+            tail_idx++;
+            continue;
+        }
+        int kernel_shift = nstl::max<int>(tail_ker_size - tail, 0);
+
+        plan.push_back(
+                {idx, ker_idx, tail_ker_size, kernel_shift, c_buf_idx});
+        tail -= tail_ker_size;
+        idx += tail_ker_size - kernel_shift;
+        c_buf_idx += tail_ker_size;
+        if (!last_tail_kernel && tail_ker_size != blk) tail_idx++;
+    }
+}
+
+void runtime_tail_plans_t::init(dim_t chunk_elems, dim_t blk, const int *tails,
+        int ntails, bool avoid_overlap) {
+    // Tables for large chunks would take more memory than they save time.
+    constexpr dim_t max_tail_with_plan = 1024;
+    avoid_overlap_ = avoid_overlap;
+    max_tail_ = static_cast<int>(
+            nstl::min(chunk_elems - 1, max_tail_with_plan));
+    // Any kernel fits before the tail once the dimension is at least that
+    // large, so a single limit represents all such dimensions.
+    max_ker_size_ = nstl::max<dim_t>(blk, tails[0]);
+    for (int overlap = 0; overlap < 2; overlap++) {
+        plans_[overlap].resize(max_tail_ + 1);
+        for (int tail = 1; tail <= max_tail_; tail++)
+            decompose(plans_[overlap][tail], tail,
+                    overlap ? max_ker_size_ : tail, blk, tails, ntails);
+    }
+}
+
+const runtime_tail_plans_t::plan_t *runtime_tail_plans_t::get(
+        dim_t tail, dim_t dim) const {
+    if (tail > max_tail_) return nullptr;
+    // The first kernel may overlap with the elements preceding the tail,
+    // so the decomposition depends on how many of them there are.
+    if (avoid_overlap_ || dim == tail) return &plans_[0][tail];
+    if (dim >= max_ker_size_) return &plans_[1][tail];
+    return nullptr;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::tune_blocking(
+        engine_t *engine, int n_candidates) const {
+    // Candidates are timed on zero-initialized buffers, which is not possible
+    // for the arguments that the execution may read values from.
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+    const auto &po = attr()->post_ops_;
+    const bool ok = attr()->has_default_values(
+                            skip_mask_t::post_ops | skip_mask_t::fpmath_mode)
+            && po.find(primitive_kind::binary) == -1
+            && po.find(primitive_kind::prelu) == -1;
+    if (!ok) return status::unimplemented;
+
+    std::shared_ptr<primitive_desc_t> best_pd;
+    double best_ms = 0;
+    for (int i = 0; i < n_candidates; i++) {
+        // Candidates share the primitive cache key, so the primitives are
+        // created directly.
+        primitive_desc_t *cand_pd_ptr = nullptr;
+        {
+            autotune::candidate_guard_t guard(i);
+            CHECK(primitive_desc_t::create<pd_t>(&cand_pd_ptr,
+                    reinterpret_cast<const op_desc_t *>(desc()), attr(), engine,
+                    nullptr));
+        }
+        std::shared_ptr<primitive_desc_t> cand_pd(cand_pd_ptr);
+        std::shared_ptr<primitive_t> p
+                = std::make_shared<brgemm_matmul_t<isa>>(
+                        static_cast<const pd_t *>(cand_pd.get()));
+        CHECK(p->init(engine, false, cache_blob_t()));
+
+        double time_ms = 0;
+        CHECK(autotune::measure(engine, p, time_ms));
+        if (!best_pd || time_ms < best_ms) {
+            best_pd = cand_pd;
+            best_ms = time_ms;
+        }
+    }
+
+    const auto &best_bgmmc
+            = static_cast<const pd_t *>(best_pd.get())->bgmmc_;
+    autotune::record(
+            autotune::get_key(best_bgmmc), autotune::blocking_t(best_bgmmc));
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 int brgemm_matmul_t<isa>::pd_t::get_brg_kernel_idx(bool is_bs_tail,
         bool do_initialization, int m_ker_idx, int n_ker_idx, bool is_K_tail,
@@ -308,9 +418,27 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_reduce(), VERBOSE_UNSUPPORTED_FEATURE,
             "reduce is not supported");
 
+    // The initial memory descriptors are kept to redo the configuration with
+    // the tuned blocking.
+    const memory_desc_t src_md_init = src_md_, weights_md_init = weights_md_,
+                        dst_md_init = dst_md_, bias_md_init = bias_md_;
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
+    if (bgmmc_.n_autotune_candidates > 1 && !autotune::is_tuning()) {
+        // Tuning failures are not fatal: the heuristics choice is kept.
+        if (tune_blocking(engine, bgmmc_.n_autotune_candidates)
+                == status::success) {
+            src_md_ = src_md_init;
+            weights_md_ = weights_md_init;
+            dst_md_ = dst_md_init;
+            bias_md_ = bias_md_init;
+            bgmmc_ = brgemm_matmul_conf_t();
+            CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_,
+                    weights_md_, dst_md_, bias_md_, attr_));
+        }
+    }
+
     // f32:f16 configuration on AVX2 doesn't support tails with proper
     // instruction sequence in copy routines. Anchor: F32_F16_AVX2_NO_TAIL.
     VDISPATCH_MATMUL(IMPLICATION((is_f32_f16 || is_f32_bf16) && isa == avx2,
@@ -466,9 +594,8 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
                 i_bs, i_init, i_M, i_N, i_K, prefetching);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        CHECK(brgemm_kernel_get_or_create(
+                brg_kernels_[idx], pd()->get_brg_desc(idx)));
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
 
@@ -492,6 +619,17 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         }
     }
 
+    const bool avoid_overlap_of_tail_and_non_tail_kernels
+            = bgmmc.nthr > 1 && bgmmc.with_sum;
+    if (bgmmc.is_runtime_M)
+        m_tail_plans_.init(bgmmc.M_chunk_elems, bgmmc.M_blk, dynamic_m_tails,
+                max_num_dynamic_m_tails,
+                avoid_overlap_of_tail_and_non_tail_kernels);
+    if (bgmmc.is_runtime_N)
+        n_tail_plans_.init(bgmmc.N_chunk_elems, bgmmc.N_blk, dynamic_n_tails,
+                max_num_dynamic_n_tails,
+                avoid_overlap_of_tail_and_non_tail_kernels);
+
     if (bgmmc.use_buffer_b && !bgmmc.packed_sparse_weights)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
@@ -550,7 +688,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     auto brgmm_ctx_ptr
-            = std::make_shared<brg_matmul_exec_ctx_t>(ctx, pd(), helper);
+            = std::make_shared<brg_matmul_exec_ctx_t>(
+                    ctx, pd(), helper, m_tail_plans_, n_tail_plans_);
 
     const int num_threads
             = brgmm_ctx_ptr->get_num_threads_for_parallelization();
@@ -1408,8 +1547,9 @@ void brgemm_matmul_t<isa>::accumulate(
 
 template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
-    brg_matmul_exec_ctx_t(
-            const exec_ctx_t &ctx, const pd_t *pd, matmul_helper_t &helper)
+    brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
+            matmul_helper_t &helper, const runtime_tail_plans_t &m_tail_plans,
+            const runtime_tail_plans_t &n_tail_plans)
         : bgmmc_(pd->get_brgemm_matmul_conf())
         , src_d_(pd->src_md())
         , wei_d_(pd->weights_md())
@@ -1558,44 +1698,20 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             M_ = helper.M();
             M_chunks_ = M_ / bgmmc.M_chunk_elems;
             M_chunk_tail_elements_ = M_ % bgmmc.M_chunk_elems;
-            int tail = M_chunk_tail_elements_;
-            dim_t m_idx = M_ - tail;
-            int tail_idx = 0;
-            dim_t m_c_buf_idx = 0;
-            while (tail > 0) {
-                int tail_ker_size = dynamic_m_tails[tail_idx];
-                int ker_idx = tail_idx + 1;
-                int prev_tail_ker_size = tail_idx > 0
-                        ? dynamic_m_tails[tail_idx - 1]
-                        : (int)bgmmc.M_blk;
-                bool last_tail_kernel = tail_idx == max_num_dynamic_m_tails - 1;
-                if (tail > tail_ker_size) {
-                    const auto max_ker_size = m_tail_processing_.empty()
-                            ? (avoid_overlap_of_tail_and_non_tail_kernels ? tail
-                                                                          : M_)
-                            : m_tail_processing_.back().kernel_size;
-                    if (max_ker_size >= prev_tail_ker_size) {
-                        tail_ker_size = prev_tail_ker_size;
-                        ker_idx--;
-                    }
-                } else if (tail < tail_ker_size && !last_tail_kernel) {
-                    // skip this tail kernel, try the next one
-                    tail_idx++;
-                    continue;
-                }
-                int kernel_m_shift = nstl::max(tail_ker_size - tail, 0);
-
-                m_tail_processing_.push_back({m_idx, ker_idx, tail_ker_size,
-                        kernel_m_shift, m_c_buf_idx});
-                tail -= tail_ker_size;
-                m_idx += tail_ker_size - kernel_m_shift;
-                m_c_buf_idx += tail_ker_size;
-                if (!last_tail_kernel && tail_ker_size != bgmmc.M_blk)
-                    tail_idx++;
+            m_tail_processing_
+                    = m_tail_plans.get(M_chunk_tail_elements_, M_);
+            if (!m_tail_processing_) {
+                runtime_tail_plans_t::decompose(m_tail_processing_storage_,
+                        M_chunk_tail_elements_,
+                        avoid_overlap_of_tail_and_non_tail_kernels
+                                ? M_chunk_tail_elements_
+                                : M_,
+                        bgmmc.M_blk, dynamic_m_tails, max_num_dynamic_m_tails);
+                m_tail_processing_ = &m_tail_processing_storage_;
             }
 
             M_tail_block_start_ = M_chunks_ * get_M_chunk_size();
-            M_chunk_tail_ = m_tail_processing_.size();
+            M_chunk_tail_ = m_tail_processing_->size();
             if (M_chunk_tail_ > 0) M_chunks_++;
             for (int dim_idx = 0; dim_idx < 3; dim_idx++)
                 A_strides_[dim_idx] = bgmmc.a_dt_sz
@@ -1624,44 +1740,19 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             N_ = helper.N();
             N_chunks_ = N_ / bgmmc.N_chunk_elems;
             N_chunk_tail_elems_ = N_ % bgmmc.N_chunk_elems;
-            int tail = N_chunk_tail_elems_;
-            dim_t n_idx = N_ - tail;
-            int tail_idx = 0;
-            dim_t n_c_buf_idx = 0;
-            while (tail > 0) {
-                int tail_ker_size = dynamic_n_tails[tail_idx];
-                int ker_idx = tail_idx + 1;
-                int prev_tail_ker_size = tail_idx > 0
-                        ? dynamic_n_tails[tail_idx - 1]
-                        : (int)bgmmc.N_blk;
-                bool last_tail_kernel = tail_idx == max_num_dynamic_n_tails - 1;
-                if (tail > tail_ker_size) {
-                    const auto max_ker_size = n_tail_processing_.empty()
-                            ? (avoid_overlap_of_tail_and_non_tail_kernels ? tail
-                                                                          : N_)
-                            : n_tail_processing_.back().kernel_size;
-                    if (max_ker_size >= prev_tail_ker_size) {
-                        tail_ker_size = prev_tail_ker_size;
-                        ker_idx--;
-                    }
-                } else if (tail < tail_ker_size && !last_tail_kernel) {
-                    // skip this tail kernel, try the next one
-                    tail_idx++;
-                    continue;
-                }
-                int kernel_n_shift = nstl::max(tail_ker_size - tail, 0);
-
-                n_tail_processing_.push_back({n_idx, ker_idx, tail_ker_size,
-                        kernel_n_shift, n_c_buf_idx});
-                tail -= tail_ker_size;
-                n_idx += tail_ker_size - kernel_n_shift;
-                n_c_buf_idx += tail_ker_size;
-                if (!last_tail_kernel && tail_ker_size != bgmmc.N_blk)
-                    tail_idx++;
+            n_tail_processing_ = n_tail_plans.get(N_chunk_tail_elems_, N_);
+            if (!n_tail_processing_) {
+                runtime_tail_plans_t::decompose(n_tail_processing_storage_,
+                        N_chunk_tail_elems_,
+                        avoid_overlap_of_tail_and_non_tail_kernels
+                                ? N_chunk_tail_elems_
+                                : N_,
+                        bgmmc.N_blk, dynamic_n_tails, max_num_dynamic_n_tails);
+                n_tail_processing_ = &n_tail_processing_storage_;
             }
 
             N_tail_block_start_ = N_chunks_ * bgmmc.N_chunk_size;
-            N_chunk_tail_ = n_tail_processing_.size();
+            N_chunk_tail_ = n_tail_processing_->size();
             if (N_chunk_tail_ > 0) N_chunks_++;
 
             for (int dim_idx = 0; dim_idx < 3; dim_idx++)
@@ -1915,9 +2006,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (is_runtime_M_tail_chunk(m_blk_idx)) {
             const int tail_idx = get_M_tail_block_idx(m_blk_idx);
             const int curr_m_block_size
-                    = m_tail_processing_[tail_idx].kernel_size;
+                    = (*m_tail_processing_)[tail_idx].kernel_size;
             const dim_t curr_m_buf_shift
-                    = m_tail_processing_[tail_idx].buf_dim_idx;
+                    = (*m_tail_processing_)[tail_idx].buf_dim_idx;
             const dim_t ld = bgmmc_.tr_a_dt_sz
                     * (bgmmc_.use_buffer_a_tail_only ? bgmmc_.wei_k_blk
                                                      : bgmmc_.LDA);
@@ -2002,11 +2093,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (runtime_M_tail || runtime_N_tail) {
             const int curr_m_block_size = get_M_kernel_size(m_blk_idx);
             const dim_t curr_m_buf_shift = runtime_M_tail
-                    ? m_tail_processing_[get_M_tail_block_idx(m_blk_idx)]
+                    ? (*m_tail_processing_)[get_M_tail_block_idx(m_blk_idx)]
                               .buf_dim_idx
                     : m_blk_local;
             const dim_t curr_n_buf_shift = runtime_N_tail
-                    ? n_tail_processing_[get_N_tail_block_idx(n_blk_idx)]
+                    ? (*n_tail_processing_)[get_N_tail_block_idx(n_blk_idx)]
                               .buf_dim_idx
                     : n_blk_local;
             const dim_t m_elems_shift = curr_m_buf_shift * bgmmc_.N_chunk_elems;
@@ -2217,7 +2308,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         if (is_runtime_M_tail_chunk(m_blk_idx)) {
             const dim_t curr_m_buf_shift
-                    = m_tail_processing_[get_M_tail_block_idx(m_blk_idx)]
+                    = (*m_tail_processing_)[get_M_tail_block_idx(m_blk_idx)]
                               .buf_dim_idx;
             return zero_point_b_compensations_ptr_
                     + ithr * bgmmc_.zp_b_comp_elems_per_thr + curr_m_buf_shift;
@@ -2234,7 +2325,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         if (is_runtime_M_tail_chunk(m_blk_idx)) {
             const dim_t curr_m_buf_shift
-                    = m_tail_processing_[get_M_tail_block_idx(m_blk_idx)]
+                    = (*m_tail_processing_)[get_M_tail_block_idx(m_blk_idx)]
                               .buf_dim_idx;
             return get_zp_b_compensation_result_ptr(ithr, 0)
                     + bgmmc_.zp_b_comp_buffer_start + curr_m_buf_shift;
@@ -2313,8 +2404,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             return 1;
 
         assert(is_runtime_M_tail_chunk(m_block_idx)
-                && !m_tail_processing_.empty());
-        return m_tail_processing_[get_M_tail_block_idx(m_block_idx)].kernel_idx;
+                && !m_tail_processing_->empty());
+        return (*m_tail_processing_)[get_M_tail_block_idx(m_block_idx)]
+                .kernel_idx;
     }
 
     int get_M_kernel_size(int m_block_idx) const {
@@ -2324,8 +2416,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             return bgmmc_.M_tail;
 
         assert(is_runtime_M_tail_chunk(m_block_idx)
-                && !m_tail_processing_.empty());
-        return m_tail_processing_[get_M_tail_block_idx(m_block_idx)]
+                && !m_tail_processing_->empty());
+        return (*m_tail_processing_)[get_M_tail_block_idx(m_block_idx)]
                 .kernel_size;
     }
 
@@ -2334,9 +2426,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (is_runtime_M_tail_chunk(m_block_idx)) {
             const int tail_idx = get_M_tail_block_idx(m_block_idx);
             const int shift = adjust_for_kernel_overlap
-                    ? m_tail_processing_[tail_idx].shift
+                    ? (*m_tail_processing_)[tail_idx].shift
                     : 0;
-            return m_tail_processing_[tail_idx].idx - shift;
+            return M_ - M_chunk_tail_elements_
+                    + (*m_tail_processing_)[tail_idx].idx - shift;
         }
         return m_block_idx * bgmmc_.M_blk;
     }
@@ -2353,8 +2446,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             return 1;
 
         assert(is_runtime_N_tail_chunk(n_block_idx)
-                && !n_tail_processing_.empty());
-        return n_tail_processing_[get_N_tail_block_idx(n_block_idx)].kernel_idx;
+                && !n_tail_processing_->empty());
+        return (*n_tail_processing_)[get_N_tail_block_idx(n_block_idx)]
+                .kernel_idx;
     }
 
     int get_N_kernel_size(int n_block_idx) const {
@@ -2364,8 +2458,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             return bgmmc_.N_tail;
 
         assert(is_runtime_N_tail_chunk(n_block_idx)
-                && !n_tail_processing_.empty());
-        return n_tail_processing_[get_N_tail_block_idx(n_block_idx)]
+                && !n_tail_processing_->empty());
+        return (*n_tail_processing_)[get_N_tail_block_idx(n_block_idx)]
                 .kernel_size;
     }
 
@@ -2374,9 +2468,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (is_runtime_N_tail_chunk(n_block_idx)) {
             const int tail_idx = get_N_tail_block_idx(n_block_idx);
             const int shift = adjust_for_kernel_overlap
-                    ? n_tail_processing_[tail_idx].shift
+                    ? (*n_tail_processing_)[tail_idx].shift
                     : 0;
-            return n_tail_processing_[tail_idx].idx - shift;
+            return N_ - N_chunk_tail_elems_
+                    + (*n_tail_processing_)[tail_idx].idx - shift;
         }
         return n_block_idx * bgmmc_.N_blk;
     }
@@ -2395,14 +2490,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         dim_t m_start = m_tail_overlapping ? get_M_idx(m_blk_idx, true)
                                            : get_M_idx(m_blk_idx);
         const int rows_to_copy = m_tail_overlapping
-                ? m_tail_processing_[get_M_tail_block_idx(m_blk_idx)].shift
+                ? (*m_tail_processing_)[get_M_tail_block_idx(m_blk_idx)].shift
                 : get_M_kernel_size(m_blk_idx);
 
         const bool n_tail_overlapping = is_n_tail_overlap(n_blk_idx);
         dim_t n_start = n_tail_overlapping ? get_N_idx(n_blk_idx, true)
                                            : get_N_idx(n_blk_idx);
         const int row_elems = n_tail_overlapping
-                ? n_tail_processing_[get_N_tail_block_idx(n_blk_idx)].shift
+                ? (*n_tail_processing_)[get_N_tail_block_idx(n_blk_idx)].shift
                 : get_N_kernel_size(n_blk_idx);
         const dim_t bytes_to_copy = bgmmc_.c_dt_sz * row_elems;
         assert(!(n_tail_overlapping && m_tail_overlapping)
@@ -2427,14 +2522,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         dim_t m_start = m_tail_overlapping ? get_M_idx(m_blk_idx, true)
                                            : get_M_idx(m_blk_idx);
         const int rows_to_copy = m_tail_overlapping
-                ? m_tail_processing_[get_M_tail_block_idx(m_blk_idx)].shift
+                ? (*m_tail_processing_)[get_M_tail_block_idx(m_blk_idx)].shift
                 : get_M_kernel_size(m_blk_idx);
 
         const bool n_tail_overlapping = is_n_tail_overlap(n_blk_idx);
         dim_t n_start = n_tail_overlapping ? get_N_idx(n_blk_idx, true)
                                            : get_N_idx(n_blk_idx);
         const int row_elems = n_tail_overlapping
-                ? n_tail_processing_[get_N_tail_block_idx(n_blk_idx)].shift
+                ? (*n_tail_processing_)[get_N_tail_block_idx(n_blk_idx)].shift
                 : get_N_kernel_size(n_blk_idx);
         const dim_t bytes_to_copy = bgmmc_.c_dt_sz * row_elems;
 
@@ -2475,22 +2570,6 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     }
 
 private:
-    struct tail_processing_t {
-        // dimension index kernel is applied to
-        dim_t idx;
-        // index of tail processing kernel, 0 is reserved for main block
-        int kernel_idx;
-        // block size of tail kernel
-        int kernel_size;
-        // shift wrt dimension index when kernel is applied w/ computational
-        // overlapping with other kernel, dim_idx_to_apply_kernel = idx - shift
-        int shift;
-        // if shift > 0 (computational overlapping case) we have to use buffer
-        // for kernel dst to avoid result values spoiling, this value
-        // represents dimensional idx for dst buffer
-        dim_t buf_dim_idx;
-    };
-
     bool is_amx_;
     bool is_A_batch_layout_trivial_;
     bool is_B_batch_layout_trivial_;
@@ -2574,8 +2653,12 @@ private:
     dim_t C_ptr_shift_b_;
     dim_t LDC_, LDD_;
     dim_t copy_B_wei_stride_;
-    std::vector<tail_processing_t> m_tail_processing_;
-    std::vector<tail_processing_t> n_tail_processing_;
+    // Tail decompositions of the runtime dimensions. They point either to
+    // the primitive's precomputed plans or to the storage below.
+    const runtime_tail_plans_t::plan_t *m_tail_processing_ = nullptr;
+    const runtime_tail_plans_t::plan_t *n_tail_processing_ = nullptr;
+    runtime_tail_plans_t::plan_t m_tail_processing_storage_;
+    runtime_tail_plans_t::plan_t n_tail_processing_storage_;
 
     char *get_buf_D_ptr(int ithr) const {
         return buf_D_ptr_ + bgmmc_.c_dt_sz * bgmmc_.M_blk * bgmmc_.N_blk * ithr;
@@ -2584,7 +2667,7 @@ private:
     int get_M_tail_block_idx(int m_block_idx) const {
         const int tail_idx = m_block_idx - M_tail_block_start_;
         if (!bgmmc_.is_runtime_M) return tail_idx;
-        return tail_idx < (int)m_tail_processing_.size() ? tail_idx : -1;
+        return tail_idx < (int)m_tail_processing_->size() ? tail_idx : -1;
     }
     bool is_M_tail_processing(int m_block_idx) const {
         return get_M_tail_block_idx(m_block_idx) >= 0;
@@ -2595,14 +2678,15 @@ private:
 
     bool is_m_tail_overlap(int m_block_idx) const {
         return is_runtime_M_tail_chunk(m_block_idx)
-                && m_tail_processing_[get_M_tail_block_idx(m_block_idx)].shift
+                && (*m_tail_processing_)[get_M_tail_block_idx(m_block_idx)]
+                                .shift
                 > 0;
     }
 
     int get_N_tail_block_idx(int n_block_idx) const {
         const int tail_idx = n_block_idx - N_tail_block_start_;
         if (!bgmmc_.is_runtime_N) return tail_idx;
-        return tail_idx < (int)n_tail_processing_.size() ? tail_idx : -1;
+        return tail_idx < (int)n_tail_processing_->size() ? tail_idx : -1;
     }
     bool is_N_tail_processing(int n_block_idx) const {
         return get_N_tail_block_idx(n_block_idx) >= 0;
@@ -2614,7 +2698,8 @@ private:
 
     bool is_n_tail_overlap(int n_block_idx) const {
         return is_runtime_N_tail_chunk(n_block_idx)
-                && n_tail_processing_[get_N_tail_block_idx(n_block_idx)].shift
+                && (*n_tail_processing_)[get_N_tail_block_idx(n_block_idx)]
+                                .shift
                 > 0;
     }
 
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -49,6 +51,51 @@ constexpr int max_num_brg_kernels_matmul = 2 * 2 * 2
         * (max_num_dynamic_m_tails + 1 /* main kernel size */)
         * 2; //prefetching on/off
 
+// Decomposition of a runtime M or N tail into calls of tail kernels.
+struct tail_processing_t {
+    // dimension index kernel is applied to, relative to the tail start
+    dim_t idx;
+    // index of tail processing kernel, 0 is reserved for main block
+    int kernel_idx;
+    // block size of tail kernel
+    int kernel_size;
+    // shift wrt dimension index when kernel is applied w/ computational
+    // overlapping with other kernel, dim_idx_to_apply_kernel = idx - shift
+    int shift;
+    // if shift > 0 (computational overlapping case) we have to use buffer
+    // for kernel dst to avoid result values spoiling, this value
+    // represents dimensional idx for dst buffer
+    dim_t buf_dim_idx;
+};
+
+// Tail decompositions of a runtime dimension for every tail size, computed
+// at primitive creation. Execution looks the decomposition up instead of
+// deriving it on each call.
+struct runtime_tail_plans_t {
+    using plan_t = std::vector<tail_processing_t>;
+
+    // Decomposes `tail` elements with kernels of size `blk` and `tails`. The
+    // first kernel may overlap with preceding elements only if its size does
+    // not exceed `max_first_ker_size`.
+    static void decompose(plan_t &plan, dim_t tail, dim_t max_first_ker_size,
+            dim_t blk, const int *tails, int ntails);
+
+    void init(dim_t chunk_elems, dim_t blk, const int *tails, int ntails,
+            bool avoid_overlap);
+
+    // Returns the decomposition of a `tail` of a dimension of size `dim`.
+    // Returns nullptr when it was not precomputed.
+    const plan_t *get(dim_t tail, dim_t dim) const;
+
+private:
+    // Decompositions with overlapping of the first kernel disabled or
+    // allowed with any kernel size, indexed by the tail size.
+    std::vector<plan_t> plans_[2];
+    dim_t max_ker_size_ = 0;
+    int max_tail_ = 0;
+    bool avoid_overlap_ = false;
+};
+
 template <cpu_isa_t isa>
 struct brgemm_matmul_t : public primitive_t {
     struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
@@ -69,6 +116,10 @@ struct brgemm_matmul_t : public primitive_t {
         }
 
     private:
+        // Times the blocking candidates of the problem and records the
+        // fastest one in the tuning database.
+        status_t tune_blocking(engine_t *engine, int n_candidates) const;
+
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
     };
@@ -112,7 +163,8 @@ private:
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    std::shared_ptr<const brgemm_kernel_t>
+            brg_kernels_[max_num_brg_kernels_matmul];
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
@@ -126,6 +178,9 @@ private:
     using reducer_t = x64::jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
     std::unique_ptr<reducer_t> reducers_[2][2];
+
+    runtime_tail_plans_t m_tail_plans_;
+    runtime_tail_plans_t n_tail_plans_;
 };
 
 } // namespace matmul
@@ -0,0 +1,263 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/profiler.hpp"
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_autotune.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+namespace autotune {
+
+namespace {
+
+thread_local int forced_candidate_idx = -1;
+
+struct database_t {
+    static database_t &get() {
+        static database_t db;
+        return db;
+    }
+
+    bool find(const std::string &key, blocking_t &blocking) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) return false;
+        blocking = it->second;
+        return true;
+    }
+
+    void add(const std::string &key, const blocking_t &blocking) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[key] = blocking;
+        if (path_.empty()) return;
+        // Entries are appended, so that concurrent processes sharing the file
+        // do not overwrite the entries of each other. The last entry for a key
+        // wins on load.
+        FILE *f = fopen(path_.c_str(), "a");
+        if (!f) return;
+        fprintf(f, "%s %s\n", key.c_str(), blocking.str().c_str());
+        fclose(f);
+    }
+
+private:
+    database_t() : path_(getenv_string_user("MATMUL_AUTOTUNE_DB")) {
+        if (path_.empty()) return;
+        std::ifstream f(path_);
+        std::string line;
+        while (std::getline(f, line)) {
+            const auto pos = line.find(' ');
+            if (pos == std::string::npos) continue;
+            blocking_t blocking;
+            if (!blocking_t::parse(line.substr(pos + 1), blocking)) continue;
+            entries_[line.substr(0, pos)] = blocking;
+        }
+    }
+
+    std::string path_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, blocking_t> entries_;
+};
+
+} // namespace
+
+blocking_t::blocking_t(const brgemm_matmul_conf_t &bgmmc)
+    : nthr_b(bgmmc.nthr_b)
+    , nthr_m(bgmmc.nthr_m)
+    , nthr_n(bgmmc.nthr_n)
+    , nthr_k(bgmmc.nthr_k)
+    , M_blk(bgmmc.M_blk)
+    , M_chunk_size(bgmmc.M_chunk_size)
+    , N_blk(bgmmc.N_blk)
+    , N_chunk_size(bgmmc.N_chunk_size)
+    , K_blk(bgmmc.K_blk)
+    , K_chunk_size(bgmmc.K_chunk_size)
+    , brgemm_batch_size(bgmmc.brgemm_batch_size) {}
+
+bool blocking_t::operator==(const blocking_t &other) const {
+    return nthr_b == other.nthr_b && nthr_m == other.nthr_m
+            && nthr_n == other.nthr_n && nthr_k == other.nthr_k
+            && M_blk == other.M_blk && M_chunk_size == other.M_chunk_size
+            && N_blk == other.N_blk && N_chunk_size == other.N_chunk_size
+            && K_blk == other.K_blk && K_chunk_size == other.K_chunk_size
+            && brgemm_batch_size == other.brgemm_batch_size;
+}
+
+std::string blocking_t::str() const {
+    std::ostringstream ss;
+    ss << nthr_b << " " << nthr_m << " " << nthr_n << " " << nthr_k << " "
+       << M_blk << " " << M_chunk_size << " " << N_blk << " " << N_chunk_size
+       << " " << K_blk << " " << K_chunk_size << " " << brgemm_batch_size;
+    return ss.str();
+}
+
+bool blocking_t::parse(const std::string &s, blocking_t &blocking) {
+    std::istringstream ss(s);
+    ss >> blocking.nthr_b >> blocking.nthr_m >> blocking.nthr_n
+            >> blocking.nthr_k >> blocking.M_blk >> blocking.M_chunk_size
+            >> blocking.N_blk >> blocking.N_chunk_size >> blocking.K_blk
+            >> blocking.K_chunk_size >> blocking.brgemm_batch_size;
+    return !ss.fail();
+}
+
+bool is_enabled() {
+    static const bool enabled = getenv_int_user("MATMUL_AUTOTUNE", 0) > 0;
+    return enabled;
+}
+
+int max_candidates() {
+    static const int n = nstl::max(
+            1, getenv_int_user("MATMUL_AUTOTUNE_MAX_CANDIDATES", 8));
+    return n;
+}
+
+std::string get_key(const brgemm_matmul_conf_t &bgmmc) {
+    // `bgmmc.nthr` is updated with the number of threads the selected
+    // blocking uses, the key relies on the number available instead.
+    std::ostringstream ss;
+    ss << isa2str(bgmmc.isa) << ",src:" << dnnl_dt2str(bgmmc.src_dt) << ":"
+       << dnnl_fmt_tag2str(bgmmc.src_tag) << ",wei:"
+       << dnnl_dt2str(bgmmc.wei_dt) << ":" << dnnl_fmt_tag2str(bgmmc.wei_tag)
+       << ",dst:" << dnnl_dt2str(bgmmc.dst_dt) << ":"
+       << dnnl_fmt_tag2str(bgmmc.dst_tag) << ",bia:"
+       << (bgmmc.with_bias ? dnnl_dt2str(bgmmc.bia_dt) : "undef")
+       << ",mb" << bgmmc.batch << "m" << bgmmc.M << "n" << bgmmc.N << "k"
+       << bgmmc.K << ",nthr:" << dnnl_get_max_threads();
+    std::string key = ss.str();
+    // The key is used as the first word of a database line.
+    std::replace(key.begin(), key.end(), ' ', '_');
+    return key;
+}
+
+int select_candidate(brgemm_matmul_conf_t &bgmmc,
+        const std::vector<blocking_t> &candidates) {
+    bgmmc.n_autotune_candidates = 0;
+    if (candidates.empty()) return 0;
+
+    const int n = static_cast<int>(candidates.size());
+    if (forced_candidate_idx >= 0) {
+        bgmmc.n_autotune_candidates = n;
+        return nstl::min(forced_candidate_idx, n - 1);
+    }
+
+    blocking_t recorded;
+    if (database_t::get().find(get_key(bgmmc), recorded)) {
+        for (int i = 0; i < n; i++)
+            if (candidates[i] == recorded) return i;
+    }
+
+    // Either the problem was never tuned or the recorded blocking is not a
+    // candidate anymore.
+    if (n > 1) bgmmc.n_autotune_candidates = n;
+    return 0;
+}
+
+void record(const std::string &key, const blocking_t &blocking) {
+    database_t::get().add(key, blocking);
+}
+
+candidate_guard_t::candidate_guard_t(int idx)
+    : prev_idx_(forced_candidate_idx) {
+    forced_candidate_idx = idx;
+}
+
+candidate_guard_t::~candidate_guard_t() {
+    forced_candidate_idx = prev_idx_;
+}
+
+bool is_tuning() {
+    return forced_candidate_idx >= 0;
+}
+
+status_t measure(engine_t *engine, const std::shared_ptr<primitive_t> &p,
+        double &time_ms) {
+    static constexpr int n_runs = 5;
+    time_ms = 0;
+
+    auto iface_deleter = [](primitive_iface_t *p_iface) {
+        if (p_iface) p_iface->release();
+    };
+    std::unique_ptr<primitive_iface_t, decltype(iface_deleter)> p_iface(
+            new primitive_iface_t(p, engine), iface_deleter);
+    CHECK(p_iface->init());
+
+    auto memory_deleter = [](memory_t *mem) { dnnl_memory_destroy(mem); };
+    std::vector<std::unique_ptr<memory_t, decltype(memory_deleter)>> mems;
+    exec_args_t args;
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS,
+                 DNNL_ARG_DST}) {
+        const memory_desc_t *md = p->pd()->arg_md(arg);
+        const memory_desc_wrapper mdw(md);
+        if (mdw.size() == 0) continue;
+
+        memory_t *mem = nullptr;
+        CHECK(dnnl_memory_create(&mem, md, engine, DNNL_MEMORY_ALLOCATE));
+        mems.emplace_back(mem, memory_deleter);
+        void *handle = nullptr;
+        CHECK(mem->get_data_handle(&handle));
+        std::memset(handle, 0, mdw.size());
+        args[arg] = {mem, arg != DNNL_ARG_DST};
+    }
+
+    auto stream_deleter = [](stream_t *stream) { dnnl_stream_destroy(stream); };
+    stream_t *stream_ptr = nullptr;
+    CHECK(dnnl_stream_create(&stream_ptr, engine, dnnl_stream_default_flags));
+    std::unique_ptr<stream_t, decltype(stream_deleter)> stream(
+            stream_ptr, stream_deleter);
+
+    // The first run warms up the caches and the memory pages.
+    double best_ms = 0;
+    for (int i = 0; i <= n_runs; i++) {
+        exec_args_t run_args = args;
+        exec_ctx_t ctx(stream.get(), std::move(run_args));
+        const double start_ms = get_msec();
+        CHECK(stream->enqueue_primitive(p_iface.get(), ctx));
+        CHECK(stream->wait());
+        const double run_ms = get_msec() - start_ms;
+        if (i == 1 || (i > 1 && run_ms < best_ms)) best_ms = run_ms;
+    }
+    time_ms = best_ms;
+    return status::success;
+}
+
+} // namespace autotune
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_AUTOTUNE_HPP
+#define CPU_X64_MATMUL_BRGEMM_MATMUL_AUTOTUNE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Empirical tuning of the AMX brgemm matmul blocking.
+//
+// When enabled with ONEDNN_MATMUL_AUTOTUNE=1, the blocking heuristics return
+// several best-scored candidates instead of one. On the first creation of a
+// primitive descriptor for a problem the candidates are timed on the machine
+// and the fastest one is recorded in a tuning database keyed by the problem
+// shape, data types, ISA and number of threads. Later creations for the same
+// problem pick the recorded blocking without timing.
+//
+// The database is kept in memory and, if ONEDNN_MATMUL_AUTOTUNE_DB is set,
+// loaded from and appended to the file it points to, so that the choices are
+// reused across runs.
+namespace autotune {
+
+// Blocking parameters that identify a candidate and are stored in the tuning
+// database.
+struct blocking_t {
+    blocking_t() = default;
+    blocking_t(const brgemm_matmul_conf_t &bgmmc);
+
+    bool operator==(const blocking_t &other) const;
+    bool operator!=(const blocking_t &other) const { return !(*this == other); }
+
+    std::string str() const;
+    static bool parse(const std::string &s, blocking_t &blocking);
+
+    int nthr_b = 0, nthr_m = 0, nthr_n = 0, nthr_k = 0;
+    dim_t M_blk = 0, M_chunk_size = 0;
+    dim_t N_blk = 0, N_chunk_size = 0;
+    dim_t K_blk = 0, K_chunk_size = 0;
+    dim_t brgemm_batch_size = 0;
+};
+
+bool is_enabled();
+
+// Maximum number of candidates timed for a problem.
+int max_candidates();
+
+// Returns the index of the candidate to apply. `candidates` are ordered from
+// the best to the worst according to the heuristics. Sets
+// `bgmmc.n_autotune_candidates` to the number of candidates when the problem
+// has to be tuned or when a candidate is forced by the tuner, and to 0
+// otherwise.
+int select_candidate(brgemm_matmul_conf_t &bgmmc,
+        const std::vector<blocking_t> &candidates);
+
+// Database key of the problem described by `bgmmc`.
+std::string get_key(const brgemm_matmul_conf_t &bgmmc);
+
+// Records the fastest blocking for a problem.
+void record(const std::string &key, const blocking_t &blocking);
+
+// Forces the heuristics on the current thread to return the candidate with
+// the given index while the object is alive. Primitive descriptors created
+// in this scope are not tuned.
+struct candidate_guard_t {
+    candidate_guard_t(int idx);
+    ~candidate_guard_t();
+
+private:
+    int prev_idx_;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(candidate_guard_t);
+};
+
+// Returns true when called within the scope of a candidate_guard_t.
+bool is_tuning();
+
+// Executes the primitive on zero-initialized buffers and returns the best time
+// of several runs.
+status_t measure(engine_t *engine, const std::shared_ptr<primitive_t> &p,
+        double &time_ms);
+
+} // namespace autotune
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
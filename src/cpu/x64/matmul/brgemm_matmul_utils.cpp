@@ -23,6 +23,7 @@
 #include "cpu/platform.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/matmul/amx_blocking_heuristics.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_autotune.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 #include "cpu/x64/matmul/postops_estimator.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
@@ -1305,11 +1306,35 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
                     bgmmc, bm_conf_utils)) {
             //grid heuristic is possible best blocking is set
             matmul_amx_blocking_params_macro_t best_blocking(bgmmc);
-            matmul_amx_blocking_params_macro_t::find_best_blocking(
-                    bgmmc, bm_conf_utils, best_blocking);
+            std::vector<matmul_amx_blocking_params_macro_t> candidates;
+            const bool autotune = autotune::is_enabled();
+            matmul_amx_blocking_params_macro_t::find_best_blocking(bgmmc,
+                    bm_conf_utils, best_blocking,
+                    autotune ? &candidates : nullptr);
 
             if (best_blocking.get_blocking_scores() != 0.0f) {
-                best_blocking.update_configuration(bgmmc);
+                if (!autotune) {
+                    best_blocking.update_configuration(bgmmc);
+                    return status::success;
+                }
+                // Keep the first occurrence of each distinct blocking
+                std::vector<brgemm_matmul_conf_t> confs;
+                std::vector<autotune::blocking_t> blockings;
+                for (const auto &c : candidates) {
+                    if ((int)confs.size() == autotune::max_candidates()) break;
+                    brgemm_matmul_conf_t conf = bgmmc;
+                    c.update_configuration(conf);
+                    const autotune::blocking_t blocking(conf);
+                    if (std::find(blockings.begin(), blockings.end(), blocking)
+                            != blockings.end())
+                        continue;
+                    confs.push_back(conf);
+                    blockings.push_back(blocking);
+                }
+                const int idx = autotune::select_candidate(bgmmc, blockings);
+                const int n_autotune_candidates = bgmmc.n_autotune_candidates;
+                bgmmc = confs[idx];
+                bgmmc.n_autotune_candidates = n_autotune_candidates;
                 return status::success;
             }
         }
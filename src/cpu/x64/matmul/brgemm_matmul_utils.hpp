@@ -292,6 +292,10 @@ struct brgemm_matmul_conf_t {
     gemv_strategy_t gemv_strategy {};
     bool gemv_swap_a_b = false;
 
+    // Number of blocking candidates to time when the autotuning is enabled
+    // and the problem was not tuned yet, 0 otherwise.
+    int n_autotune_candidates = 0;
+
     inline bool lda_big_pow2() const {
         const dim_t big_stride_threshold_in_bytes = 8192;
         const dim_t big_K_threshold = big_stride_threshold_in_bytes / a_dt_sz;
@@ -32,11 +32,15 @@ struct dnnl_ukernel_attr_params : public dnnl::impl::c_compatible {
     dnnl::impl::status_t set_scales(const void *scales, int arg);
     const void *get_scales(int arg) const;
 
+    dnnl::impl::status_t set_zero_points(const void *zero_points, int arg);
+    const void *get_zero_points(int arg) const;
+
 private:
     const void *post_ops_args_;
     const void *a_scales_;
     const void *b_scales_;
     const void *d_scales_;
+    const void *b_zero_points_;
 };
 
 namespace dnnl {
@@ -57,6 +61,9 @@ status_t dnnl_ukernel_attr_params_set_A_scales(
 status_t dnnl_ukernel_attr_params_set_B_scales(
         dnnl_ukernel_attr_params *attr_params, const void *b_scales);
 
+status_t dnnl_ukernel_attr_params_set_B_zero_points(
+        dnnl_ukernel_attr_params *attr_params, const void *b_zero_points);
+
 status_t dnnl_ukernel_attr_params_set_D_scales(
         dnnl_ukernel_attr_params *attr_params, const void *d_scales);
 
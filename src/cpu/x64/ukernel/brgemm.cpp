@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/verbose.hpp"
 
@@ -238,6 +239,72 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
     return status::success;
 }
 
+status_t brgemm_t::execute(const brgemm_problem_t *problems, dim_t nproblems,
+        void *scratchpad_ptr, int nthr) const {
+    if (nproblems == 0) return status::success;
+
+    if (reinterpret_cast<uintptr_t>(scratchpad_ptr) % k_cache_line != 0
+            && get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        VWARN(primitive, ukernel, "Scratchpad is not cache-line aligned");
+
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    const size_t wsp_size = brgemm_desc_.get_wsp_buffer_size();
+    const size_t wsp_size_aligned = utils::rnd_up(wsp_size, k_cache_line);
+    // A multiple of the cache line size, so per-thread parts stay aligned.
+    const size_t thr_scratchpad_size = get_scratchpad_size();
+
+    // Problems assigned to a thread run back-to-back, reusing the batch
+    // elements storage of that thread.
+    auto execute_problems = [&](int ithr, dim_t start, dim_t end) {
+        char *thr_scratchpad = reinterpret_cast<char *>(scratchpad_ptr)
+                + ithr * thr_scratchpad_size;
+        auto *v_batch_element = reinterpret_cast<brgemm_batch_element_t *>(
+                thr_scratchpad + wsp_size_aligned);
+        for (dim_t p = start; p < end; p++) {
+            const auto &problem = problems[p];
+            for (int i = 0; i < batch_size; i++) {
+                v_batch_element[i].offset.A = problem.A_B_offsets[2 * i];
+                v_batch_element[i].offset.B = problem.A_B_offsets[2 * i + 1];
+            }
+            brgemm_kernel_execute(brgemm_kernel_, batch_size, problem.A,
+                    problem.B, v_batch_element, problem.C, thr_scratchpad,
+                    /* dynamic_values = */ nullptr);
+        }
+    };
+
+    double start_ms = 0;
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        start_ms = get_msec();
+
+    nthr = static_cast<int>(nstl::min<dim_t>(nthr, nproblems));
+    if (nthr == 1) {
+        execute_problems(0, 0, nproblems);
+    } else {
+        std::vector<status_t> thr_status(nthr, status::success);
+        parallel(nthr, [&](int ithr, int nthr_) {
+            dim_t start = 0, end = 0;
+            balance211(nproblems, nthr_, ithr, start, end);
+            // The hardware context is thread-local, and worker threads don't
+            // share it with the calling thread.
+            thr_status[ithr] = set_hw_context();
+            if (thr_status[ithr] != status::success) return;
+            execute_problems(ithr, start, end);
+        });
+        for (const auto s : thr_status)
+            CHECK(s);
+    }
+
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double duration_ms = get_msec() - start_ms;
+
+        stringstream_t ss;
+        ss << "cpu,brgemm,,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    }
+    return status::success;
+}
+
 status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         const dim_t *A_B_offsets, const void *C_ptr, void *D_ptr,
         void *scratchpad_ptr, const attr_params_t *attr_params) const {
@@ -466,6 +533,17 @@ status_t dnnl_brgemm_execute(const brgemm_t *brgemm, const void *A_ptr,
     return status::success;
 }
 
+status_t dnnl_brgemm_execute_batch(const brgemm_t *brgemm,
+        const brgemm_problem_t *problems, dim_t nproblems,
+        void *scratchpad_ptr, int nthr) {
+    if (utils::any_null(brgemm, problems, scratchpad_ptr) || nproblems < 0
+            || nthr <= 0)
+        return status::invalid_arguments;
+
+    CHECK(brgemm->execute(problems, nproblems, scratchpad_ptr, nthr));
+    return status::success;
+}
+
 status_t dnnl_brgemm_execute_postops(const brgemm_t *brgemm, const void *A_ptr,
         const void *B_ptr, const dim_t *A_B_offsets, const void *C_ptr,
         void *D_ptr, void *scratchpad_ptr, const attr_params_t *attr_params) {
@@ -74,6 +74,11 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
     dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
             const dnnl::impl::dim_t *A_B_offsets, void *C_ptr,
             void *scratchpad_ptr) const;
+    // Executes problems one after another, distributing them between `nthr`
+    // threads. Each thread uses its own part of the scratchpad.
+    dnnl::impl::status_t execute(
+            const dnnl::impl::cpu::ukernel::brgemm_problem_t *problems,
+            dnnl::impl::dim_t nproblems, void *scratchpad_ptr, int nthr) const;
     dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
             const dnnl::impl::dim_t *A_B_offsets, const void *C_ptr,
             void *D_ptr, void *scratchpad_ptr,
@@ -144,6 +149,10 @@ status_t dnnl_brgemm_execute(const dnnl_brgemm *brgemm, const void *A_ptr,
         const void *B_ptr, const dim_t *A_B_offsets, void *C_ptr,
         void *scratchpad_ptr);
 
+status_t dnnl_brgemm_execute_batch(const dnnl_brgemm *brgemm,
+        const cpu::ukernel::brgemm_problem_t *problems, dim_t nproblems,
+        void *scratchpad_ptr, int nthr);
+
 status_t dnnl_brgemm_execute_postops(const dnnl_brgemm *brgemm,
         const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
         const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
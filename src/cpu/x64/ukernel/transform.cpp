@@ -62,10 +62,126 @@ dnnl_transform::dnnl_transform(dim_t K, dim_t N, pack_type_t in_pack_type,
     }
 }
 
+status_t transform_t::set_B_scales(
+        int mask, dim_t k_group_size, data_type_t dt) {
+    VCHECK_TRANSFORM(pack_B_kernel_ == nullptr,
+            "B scales can't be set after the kernel is generated");
+    VCHECK_TRANSFORM(utils::one_of(mask, 0, 1, 2, 3),
+            "B scales mask must be one of 0, 1, 2, or 3");
+    VCHECK_TRANSFORM(IMPLICATION(mask & 1, k_group_size > 0),
+            "B scales group size must be positive");
+    VCHECK_TRANSFORM(
+            utils::one_of(dt, data_type::f32, data_type::bf16, data_type::f16),
+            "B scales data type must be one of f32, bf16, or f16");
+
+    b_scale_mask_ = mask;
+    b_scale_k_group_size_ = (mask & 1) ? k_group_size : 0;
+    b_scale_dt_ = dt;
+    return status::success;
+}
+
+status_t transform_t::set_B_zero_points(
+        int mask, dim_t k_group_size, data_type_t dt) {
+    VCHECK_TRANSFORM(pack_B_kernel_ == nullptr,
+            "B zero points can't be set after the kernel is generated");
+    VCHECK_TRANSFORM(utils::one_of(mask, 0, 1, 2, 3),
+            "B zero points mask must be one of 0, 1, 2, or 3");
+    VCHECK_TRANSFORM(IMPLICATION(mask & 1, k_group_size > 0),
+            "B zero points group size must be positive");
+    VCHECK_TRANSFORM(utils::one_of(dt, data_type::s32, data_type::s8,
+                             data_type::u8, data_type::s4, data_type::u4),
+            "B zero points data type must be one of s32, s8, u8, s4, or u4");
+
+    b_zp_mask_ = mask;
+    b_zp_k_group_size_ = (mask & 1) ? k_group_size : 0;
+    b_zp_dt_ = dt;
+    return status::success;
+}
+
+status_t transform_t::init_decompression_conf() {
+    const bool with_scales = b_scale_mask_ >= 0;
+    const bool with_zp = b_zp_mask_ >= 0;
+    if (!with_scales && !with_zp) return status::success;
+
+    VCHECK_TRANSFORM(bmc_.with_wei_decompression,
+            "B scales and zero points require integer input data type and "
+            "floating-point output data type");
+
+    const bool is_int4 = utils::one_of(in_dt_, data_type::s4, data_type::u4);
+    const dim_t vnni_granularity = data_type_vnni_granularity(out_dt_);
+    auto is_valid_group = [&](dim_t k_group_size) {
+        if (k_group_size == 0) return true;
+        // The kernel processes a block of rows sharing parameters at once,
+        // so a group may neither cross a K block nor split a VNNI row group.
+        const bool is_group_aligned = k_group_size % vnni_granularity == 0
+                && IMPLICATION(is_int4, k_group_size % 2 == 0);
+        const bool is_group_blocked = bmc_.K_blk % k_group_size == 0
+                || k_group_size % bmc_.K_blk == 0;
+        return K_ % k_group_size == 0 && is_group_aligned && is_group_blocked;
+    };
+
+    if (with_scales) {
+        VCHECK_TRANSFORM(is_valid_group(b_scale_k_group_size_),
+                "Unsupported B scales group size %d",
+                (int)b_scale_k_group_size_);
+        bmc_.with_wei_scales = true;
+        bmc_.is_wei_scale_common = b_scale_mask_ == 0;
+        bmc_.is_wei_scale_per_k = b_scale_mask_ & 1;
+        bmc_.is_wei_scale_per_n = b_scale_mask_ & 2;
+        // Unlike matmul, all scales are applied during packing as the
+        // ukernel may not know the rows the packed block came from.
+        bmc_.apply_scales_in_buffer_b = true;
+        bmc_.wei_scales_dt = b_scale_dt_;
+        bmc_.wei_scales_dt_sz = types::data_type_size(b_scale_dt_);
+        bmc_.wei_scales_k_gsize = b_scale_k_group_size_;
+    }
+
+    if (with_zp) {
+        VCHECK_TRANSFORM(is_valid_group(b_zp_k_group_size_),
+                "Unsupported B zero points group size %d",
+                (int)b_zp_k_group_size_);
+        VCHECK_TRANSFORM(IMPLICATION(with_scales && (b_scale_mask_ & 1)
+                                         && (b_zp_mask_ & 1),
+                                 b_scale_k_group_size_ == b_zp_k_group_size_),
+                "B scales and zero points group sizes must match");
+        bmc_.has_zero_point_b = true;
+        bmc_.is_wei_zp_common = b_zp_mask_ == 0;
+        bmc_.is_wei_zp_per_k = b_zp_mask_ & 1;
+        bmc_.is_wei_zp_per_n = b_zp_mask_ & 2;
+        bmc_.wei_zp_dt = b_zp_dt_;
+        bmc_.wei_zp_k_gsize = b_zp_k_group_size_;
+        bmc_.wei_zp_type = bmc_.is_wei_zp_common
+                ? brgemm_broadcast_t::per_tensor
+                : brgemm_broadcast_t::per_n;
+    }
+
+    return status::success;
+}
+
+dim_t transform_t::get_B_scales_offset(dim_t k, dim_t n) const {
+    if (b_scale_mask_ <= 0) return 0;
+    const dim_t n_off = (b_scale_mask_ & 2) ? n : 0;
+    const dim_t n_str = (b_scale_mask_ & 2) ? N_ : 1;
+    const dim_t k_off = (b_scale_mask_ & 1) ? k / b_scale_k_group_size_ : 0;
+    return (k_off * n_str + n_off) * types::data_type_size(b_scale_dt_);
+}
+
+dim_t transform_t::get_B_zero_points_offset(dim_t k, dim_t n) const {
+    if (b_zp_mask_ <= 0) return 0;
+    const dim_t n_off = (b_zp_mask_ & 2) ? n : 0;
+    const dim_t n_str = (b_zp_mask_ & 2) ? N_ : 1;
+    const dim_t k_off = (b_zp_mask_ & 1) ? k / b_zp_k_group_size_ : 0;
+    const dim_t elems_per_byte
+            = utils::one_of(b_zp_dt_, data_type::s4, data_type::u4) ? 2 : 1;
+    return (k_off * n_str + n_off) * types::data_type_size(b_zp_dt_)
+            / elems_per_byte;
+}
+
 status_t transform_t::generate() {
     // Re-generation won't take any effect.
     if (pack_B_kernel_ != nullptr) return status::success;
 
+    CHECK(init_decompression_conf());
     CHECK(matmul::create_brgemm_matmul_copy_b(pack_B_kernel_, &bmc_));
 
     // Generate a verbose info string at the point where configuration is done.
@@ -75,7 +191,8 @@ status_t transform_t::generate() {
     return status::success;
 }
 
-status_t transform_t::execute(const void *src, void *dst) const {
+status_t transform_t::execute(
+        const void *src, void *dst, const attr_params_t *attr_params) const {
     double start_ms = 0;
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
         start_ms = get_msec();
@@ -90,39 +207,73 @@ status_t transform_t::execute(const void *src, void *dst) const {
 
     const auto i_dt_sz = kernel_conf.b_dt_sz;
     const auto o_dt_sz = kernel_conf.a_dt_sz;
+    // Packed 4-bit values take half a byte each.
+    const dim_t i_elems_per_byte
+            = utils::one_of(in_dt_, data_type::s4, data_type::u4) ? 2 : 1;
+
+    const uint8_t *scales_ptr = nullptr;
+    const uint8_t *zp_ptr = nullptr;
+    if (b_scale_mask_ >= 0 || b_zp_mask_ >= 0) {
+        VCHECK_TRANSFORM(attr_params != nullptr,
+                "Attribute parameters must be passed to decompress B");
+        scales_ptr = reinterpret_cast<const uint8_t *>(
+                attr_params->get_scales(DNNL_ARG_WEIGHTS));
+        zp_ptr = reinterpret_cast<const uint8_t *>(
+                attr_params->get_zero_points(DNNL_ARG_WEIGHTS));
+        VCHECK_TRANSFORM(IMPLICATION(b_scale_mask_ >= 0, scales_ptr),
+                "B scales argument is not set");
+        VCHECK_TRANSFORM(IMPLICATION(b_zp_mask_ >= 0, zp_ptr),
+                "B zero points argument is not set");
+    }
 
-    for (dim_t n_blk_idx = 0; n_blk_idx < n_blks; n_blk_idx++) {
+    // Grouped parameters change inside of a block when groups are smaller
+    // than the block, such blocks are packed by a group at a time.
+    const dim_t k_group_size = kernel_conf.is_wei_zp_per_k
+            ? kernel_conf.wei_zp_k_gsize
+            : kernel_conf.wei_scales_k_gsize;
+    const dim_t k_step = k_group_size > 0
+            ? nstl::min(kernel_conf.K_blk, k_group_size)
+            : kernel_conf.K_blk;
+
+    auto ker_exec_ctx = matmul::jit_brgemm_matmul_copy_b_t::ctx_t();
+    auto execute_block = [&](dim_t k_blk_idx, dim_t n_blk_idx, dim_t k_iters) {
+        const auto k_blk_start = k_blk_idx * kernel_conf.K_blk;
         const auto n = n_blk_idx * kernel_conf.N_blk;
-        const bool is_N_tail = (kernel_conf.N - n) < kernel_conf.N_blk;
-        auto ker_exec_ctx = matmul::jit_brgemm_matmul_copy_b_t::ctx_t();
-        ker_exec_ctx.current_N_blk
-                = is_N_tail ? kernel_conf.N_tail : kernel_conf.N_blk;
-
-        int k_blk_idx = 0;
-        for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
-            ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
-            ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_blk;
-            (*pack_B_kernel_)(&ker_exec_ctx);
-        }
-        if (kernel_conf.K_tail > 0) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
+        const auto blk_dst_offset
+                = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
+        for (dim_t k_in_blk = 0; k_in_blk < k_iters; k_in_blk += k_step) {
+            const auto k = k_blk_start + k_in_blk;
             const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
+                    = i_dt_sz * (k * strides_[0] + n * strides_[1])
+                    / i_elems_per_byte;
             const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
+                    = blk_dst_offset + o_dt_sz * k_in_blk * kernel_conf.N_blk;
             ker_exec_ctx.src = &src_ptr[src_offset];
             ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
             ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_tail;
+            ker_exec_ctx.current_K_iters
+                    = nstl::min(k_step, k_iters - k_in_blk);
+            if (scales_ptr)
+                ker_exec_ctx.wei_scales_ptr
+                        = &scales_ptr[get_B_scales_offset(k, n)];
+            if (zp_ptr)
+                ker_exec_ctx.zp_b_value_ptr
+                        = &zp_ptr[get_B_zero_points_offset(k, n)];
             (*pack_B_kernel_)(&ker_exec_ctx);
         }
+    };
+
+    for (dim_t n_blk_idx = 0; n_blk_idx < n_blks; n_blk_idx++) {
+        const auto n = n_blk_idx * kernel_conf.N_blk;
+        const bool is_N_tail = (kernel_conf.N - n) < kernel_conf.N_blk;
+        ker_exec_ctx.current_N_blk
+                = is_N_tail ? kernel_conf.N_tail : kernel_conf.N_blk;
+
+        int k_blk_idx = 0;
+        for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++)
+            execute_block(k_blk_idx, n_blk_idx, kernel_conf.K_blk);
+        if (kernel_conf.K_tail > 0)
+            execute_block(k_blk_idx, n_blk_idx, kernel_conf.K_tail);
     }
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
@@ -171,12 +322,33 @@ status_t dnnl_transform_create(transform_t **transform, dim_t K, dim_t N,
     if (transform == nullptr) return status::invalid_arguments;
     VCHECK_TRANSFORM(utils::one_of(out_ld, 16, 32, 48, 64),
             "Transform routine supports only \'out_ld\' of 16, 32, 48, or 64.");
+    VCHECK_TRANSFORM(IMPLICATION(utils::one_of(in_dt, data_type::s4,
+                                         data_type::u4),
+                             in_ld % 2 == 0),
+            "Transform routine supports only even \'in_ld\' for 4-bit "
+            "inputs.");
 
     *transform
             = new transform_t(K, N, in_pack_type, in_ld, out_ld, in_dt, out_dt);
     return status::success;
 }
 
+status_t dnnl_transform_set_B_scales(transform_t *transform, int b_scale_mask,
+        dim_t k_group_size, data_type_t b_scale_dt) {
+    if (transform == nullptr) return status::invalid_arguments;
+
+    CHECK(transform->set_B_scales(b_scale_mask, k_group_size, b_scale_dt));
+    return status::success;
+}
+
+status_t dnnl_transform_set_B_zero_points(transform_t *transform,
+        int b_zp_mask, dim_t k_group_size, data_type_t b_zp_dt) {
+    if (transform == nullptr) return status::invalid_arguments;
+
+    CHECK(transform->set_B_zero_points(b_zp_mask, k_group_size, b_zp_dt));
+    return status::success;
+}
+
 status_t dnnl_transform_generate(transform_t *transform) {
     if (transform == nullptr) return status::invalid_arguments;
 
@@ -193,6 +365,15 @@ status_t dnnl_transform_execute(
     return status::success;
 }
 
+status_t dnnl_transform_execute_ext(const transform_t *transform,
+        const void *in_ptr, void *out_ptr, const attr_params_t *attr_params) {
+    if (utils::any_null(transform, in_ptr, out_ptr, attr_params))
+        return status::invalid_arguments;
+
+    CHECK(transform->execute(in_ptr, out_ptr, attr_params));
+    return status::success;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
     delete transform;
     return status::success;
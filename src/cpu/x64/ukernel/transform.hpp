@@ -21,6 +21,8 @@
 
 #include "cpu/ukernel/c_types_map.hpp"
 
+#include "cpu/x64/ukernel/attr_params.hpp"
+
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 
@@ -33,17 +35,35 @@ struct dnnl_transform : public dnnl::impl::c_compatible {
             dnnl::impl::dim_t in_ld, dnnl::impl::dim_t out_ld,
             dnnl::impl::data_type_t in_dt, dnnl::impl::data_type_t out_dt);
 
+    // Sets decompression parameters for integer inputs. A mask bit 0 stands
+    // for K dimension, bit 1 stands for N dimension.
+    dnnl::impl::status_t set_B_scales(int mask, dnnl::impl::dim_t k_group_size,
+            dnnl::impl::data_type_t dt);
+    dnnl::impl::status_t set_B_zero_points(int mask,
+            dnnl::impl::dim_t k_group_size, dnnl::impl::data_type_t dt);
+
     // Generates a transform kernel.
     dnnl::impl::status_t generate();
 
-    // Executes a transform kernel.
-    dnnl::impl::status_t execute(const void *src, void *dst) const;
+    // Executes a transform kernel. B scales and zero points are taken from
+    // `attr_params` when they were set.
+    dnnl::impl::status_t execute(const void *src, void *dst,
+            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params
+            = nullptr) const;
 
 private:
     // User's inputs.
     dnnl::impl::dim_t K_, N_;
     dnnl::impl::dim_t in_ld_, out_ld_;
     dnnl::impl::data_type_t in_dt_, out_dt_;
+    // Decompression parameters. A negative mask means the parameter is not
+    // set.
+    int b_scale_mask_ = -1;
+    dnnl::impl::dim_t b_scale_k_group_size_ = 0;
+    dnnl::impl::data_type_t b_scale_dt_ = dnnl::impl::data_type::undef;
+    int b_zp_mask_ = -1;
+    dnnl::impl::dim_t b_zp_k_group_size_ = 0;
+    dnnl::impl::data_type_t b_zp_dt_ = dnnl::impl::data_type::undef;
     // Save `strides_` for `execute` to get proper source offset.
     dnnl::impl::dims_t strides_ {};
 
@@ -55,6 +75,17 @@ private:
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t>
             pack_B_kernel_;
 
+    // Updates `bmc_` with decompression parameters prior to kernel
+    // generation.
+    dnnl::impl::status_t init_decompression_conf();
+
+    // Returns the offsets of scales and zero points for the block starting at
+    // (`k`, `n`).
+    dnnl::impl::dim_t get_B_scales_offset(
+            dnnl::impl::dim_t k, dnnl::impl::dim_t n) const;
+    dnnl::impl::dim_t get_B_zero_points_offset(
+            dnnl::impl::dim_t k, dnnl::impl::dim_t n) const;
+
     // Creates a `verbose_info_` string once during `generate()` call, and calls
     // it during execute(). This is done to avoid string re-creation.
     dnnl::impl::status_t create_verbose_info();
@@ -71,11 +102,21 @@ status_t dnnl_transform_create(dnnl_transform **transform, dim_t K, dim_t N,
         dnnl::impl::cpu::ukernel::pack_type_t in_pack_type, dim_t in_ld,
         dim_t out_ld, data_type_t in_dt, data_type_t out_dt);
 
+status_t dnnl_transform_set_B_scales(dnnl_transform *transform,
+        int b_scale_mask, dim_t k_group_size, data_type_t b_scale_dt);
+
+status_t dnnl_transform_set_B_zero_points(dnnl_transform *transform,
+        int b_zp_mask, dim_t k_group_size, data_type_t b_zp_dt);
+
 status_t dnnl_transform_generate(dnnl_transform *transform);
 
 status_t dnnl_transform_execute(
         const dnnl_transform *transform, const void *in_ptr, void *out_ptr);
 
+status_t dnnl_transform_execute_ext(const dnnl_transform *transform,
+        const void *in_ptr, void *out_ptr,
+        const dnnl_ukernel_attr_params *attr_params);
+
 status_t dnnl_transform_destroy(dnnl_transform *transform);
 
 } // namespace ukernel
@@ -17,6 +17,9 @@
 #include <cassert>
 #include <type_traits>
 
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/platform.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_avx512_core_fp8cvt.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
@@ -30,6 +33,15 @@ namespace io {
 io_conf_t::io_conf_t(const bool nt_stores_enabled)
     : nt_stores_enabled_(nt_stores_enabled) {}
 
+bool use_nt_stores(const primitive_attr_t *attr, size_t dst_size) {
+    const store_mode_t mode = attr ? attr->store_mode_ : store_mode::any;
+    if (mode != store_mode::any) return mode == store_mode::nontemporal;
+
+    const size_t llc_size = static_cast<size_t>(dnnl_get_max_threads())
+            * platform::get_per_core_cache_size(3);
+    return llc_size > 0 && dst_size > llc_size;
+}
+
 io_tail_conf_t::io_tail_conf_t(const std::size_t simd_w,
         const std::size_t tail_size, const Xbyak::Opmask &tail_opmask,
         const int tail_vmm_mask_idx, const Xbyak::Reg64 &reg_tmp)
@@ -750,8 +762,8 @@ void jit_io_helper_t<Vmm>::store(const Vmm &src_raw_vmm,
         const Xbyak::Address &dst_raw_addr, const bool tail) {
     assert(IMPLICATION(tail, tail_conf_.has_value())
             && "Config for tail processing is not set.");
-    assert(!(tail && io_conf_.nt_stores_enabled_)
-            && "Usage of non-temporal stores with tail leads to a general-protection exception.");
+    // Non-temporal stores with tail lead to a general-protection exception.
+    const bool nt = io_conf_.nt_stores_enabled_ && !tail;
 
     const bool is_avx512 = is_superset(isa_, avx512_core);
 
@@ -789,14 +801,14 @@ void jit_io_helper_t<Vmm>::store(const Vmm &src_raw_vmm,
     } else {
         switch (data_type_) {
             case data_type::f32:
-            case data_type::s32: store_f32(src_vmm, dst_addr, tail); break;
-            case data_type::bf16: store_bf16(src_vmm, dst_addr); break;
-            case data_type::f16: store_f16(src_vmm, dst_addr); break;
+            case data_type::s32: store_f32(src_vmm, dst_addr, tail, nt); break;
+            case data_type::bf16: store_bf16(src_vmm, dst_addr, nt); break;
+            case data_type::f16: store_f16(src_vmm, dst_addr, nt); break;
             case data_type::f8_e4m3:
-            case data_type::f8_e5m2: store_f8(src_vmm, dst_addr); break;
+            case data_type::f8_e5m2: store_f8(src_vmm, dst_addr, nt); break;
             case data_type::s8:
             case data_type::u8:
-                store_i8(src_vmm, dst_raw_addr, use_sat_cvt);
+                store_i8(src_vmm, dst_raw_addr, use_sat_cvt, nt);
                 break;
             default: assert(!"Unsupported data type.");
         }
@@ -833,9 +845,9 @@ void jit_io_helper_t<Vmm>::store_byte_by_byte(const Vmm &src_vmm,
 }
 
 template <typename Vmm>
-void jit_io_helper_t<Vmm>::store_f32(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr, const bool tail) {
-    if (io_conf_.nt_stores_enabled_)
+void jit_io_helper_t<Vmm>::store_f32(const Vmm &src_vmm,
+        const Xbyak::Address &dst_addr, const bool tail, const bool nt) {
+    if (nt)
         host_->uni_vmovntps(dst_addr, src_vmm);
     else if (!is_superset(isa_, avx512_core) && tail)
         host_->vmaskmovps(
@@ -846,7 +858,7 @@ void jit_io_helper_t<Vmm>::store_f32(
 
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_bf16(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+        const Vmm &src_vmm, const Xbyak::Address &dst_addr, const bool nt) {
     assert(bf16_supported_ && "Unsupported data type.");
     assert((src_vmm.isZMM() || src_vmm.isYMM())
             && "Store operation for bf16 is not supported for Xmms.");
@@ -859,7 +871,7 @@ void jit_io_helper_t<Vmm>::store_bf16(
     else
         host_->vcvtneps2bf16(cvt_lower_vmm, src_vmm, host_->get_encoding());
 
-    if (io_conf_.nt_stores_enabled_)
+    if (nt)
         host_->uni_vmovntps(dst_addr, cvt_lower_vmm);
     else
         host_->uni_vmovdqu16(dst_addr, cvt_lower_vmm);
@@ -867,7 +879,7 @@ void jit_io_helper_t<Vmm>::store_bf16(
 
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_f16(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+        const Vmm &src_vmm, const Xbyak::Address &dst_addr, const bool nt) {
     assert(f16_supported_ && "Unsupported data type.");
     assert((src_vmm.isZMM() || src_vmm.isYMM())
             && "Store operation for f16 is not supported for Xmms.");
@@ -877,7 +889,7 @@ void jit_io_helper_t<Vmm>::store_f16(
 
     host_->uni_vcvtps2phx(cvt_lower_vmm, src_vmm);
 
-    if (io_conf_.nt_stores_enabled_)
+    if (nt)
         host_->uni_vmovntps(dst_addr, cvt_lower_vmm);
     else
         host_->uni_vmovdqu16(dst_addr, cvt_lower_vmm);
@@ -885,7 +897,7 @@ void jit_io_helper_t<Vmm>::store_f16(
 
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_f8(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+        const Vmm &src_vmm, const Xbyak::Address &dst_addr, const bool nt) {
     assert(fp8_supported_ && fp8_cvt_
             && "Unsupported data type or emulation not available.");
 
@@ -895,7 +907,7 @@ void jit_io_helper_t<Vmm>::store_f8(
         fp8_cvt_->vcvt_f32_to_f8(
                 lower_xmm | Xbyak::Opmask(src_vmm.getOpmaskIdx()), src_vmm);
 
-    if (io_conf_.nt_stores_enabled_)
+    if (nt)
         host_->vmovntps(dst_addr, lower_xmm);
     else
         host_->vmovdqu8(dst_addr, lower_xmm);
@@ -903,7 +915,7 @@ void jit_io_helper_t<Vmm>::store_f8(
 
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_i8(const Vmm &src_vmm,
-        const Xbyak::Address &dst_addr, const bool use_sat_cvt) {
+        const Xbyak::Address &dst_addr, const bool use_sat_cvt, const bool nt) {
     if (use_sat_cvt && isa_has_sat_cvt(isa_, data_type_)) {
         host_->vpmovusdb(dst_addr, src_vmm);
     } else if (!is_superset(isa_, avx512_core)) {
@@ -922,7 +934,7 @@ void jit_io_helper_t<Vmm>::store_i8(const Vmm &src_vmm,
                 ? std::bind(&jit_generator_t::vpmovsdb, host_, _1, _2)
                 : std::bind(&jit_generator_t::vpmovusdb, host_, _1, _2);
 
-        if (io_conf_.nt_stores_enabled_ && is_zmm) {
+        if (nt && is_zmm) {
             Xbyak::Xmm src_xmm(src_vmm.getIdx());
             store_i8_fn(src_xmm, src_vmm);
             host_->uni_vmovntps(dst_addr, src_xmm);
@@ -22,6 +22,7 @@
 #include <unordered_set>
 
 #include "common/optional.hpp"
+#include "common/primitive_attr.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -44,9 +45,18 @@ public:
 
     io_conf_t &operator=(const io_conf_t &other) = default;
 
+    // Non-temporal stores require the destination address to be aligned on
+    // the vector length. Stores with tail fall back to regular stores.
     bool nt_stores_enabled_ = false;
 };
 
+// Returns true if a destination of `dst_size` bytes should be written with
+// non-temporal stores. Unless forced by the store mode attribute, streaming
+// stores are used only when the destination does not fit into the last level
+// cache available to the threads, so that it would be evicted before being
+// read again anyway.
+bool use_nt_stores(const primitive_attr_t *attr, size_t dst_size);
+
 class io_tail_conf_t {
 public:
     io_tail_conf_t(const std::size_t simd_w, const std::size_t tail_size,
@@ -228,12 +238,15 @@ private:
     void store_byte_by_byte(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
             const int store_size);
     void store_f32(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
-            const bool tail);
-    void store_bf16(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
-    void store_f16(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
-    void store_f8(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
+            const bool tail, const bool nt);
+    void store_bf16(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool nt);
+    void store_f16(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool nt);
+    void store_f8(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool nt);
     void store_i8(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
-            const bool use_sat_cvt);
+            const bool use_sat_cvt, const bool nt);
     void convert_to_f32(const Vmm &dst_vmm, const Xbyak::Xmm &src_vmm,
             const data_type_t src_data_type);
 
@@ -53,6 +53,8 @@ struct ref_layer_normalization_fwd_t : public gpu::generic::sycl::primitive_t {
             const memory_desc_wrapper var_d(src_md(2));
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!use_residual(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "residual");
             VDISPATCH_LNORM((src_md(0)->format_desc.blocking.inner_nblks == 0),
                     VERBOSE_UNSUPPORTED_FORMAT_KIND);
             VDISPATCH_LNORM(is_supported_type(src_md(0)->data_type),
@@ -51,6 +51,8 @@ struct ref_fwd_t : public primitive_t {
             bool uses_f64 = utils::one_of(f64, src_dt, dst_dt);
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!use_residual(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "residual");
             VDISPATCH_LNORM(IMPLICATION(uses_f16,
                                     intel_engine->mayiuse(
                                             compute::device_ext_t::khr_fp16))
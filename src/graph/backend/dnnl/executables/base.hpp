@@ -117,6 +117,12 @@ struct op_executable_t {
             const std::unordered_map<int, memory> &args) const
             = 0;
     virtual bool is_initialized() const = 0;
+
+    // Prefetch hook: returns the arguments which are worth bringing into the
+    // cache before the executable runs, e.g. weights of memory-bound matmuls.
+    // See weight_prefetcher_t.
+    virtual std::vector<int> get_prefetch_args() const { return {}; }
+
 #ifdef DNNL_WITH_SYCL
     virtual ::sycl::event execute_sycl(const stream &stream,
             const std::unordered_map<int, memory> &args,
@@ -55,6 +55,10 @@ struct conv_fwd_executable_t : public op_executable_t {
 
     bool is_initialized() const override { return bool(prim_); }
 
+    std::vector<int> get_prefetch_args() const override {
+        return {DNNL_ARG_WEIGHTS};
+    }
+
 private:
     dnnl::convolution_forward prim_;
     bool with_sum_ {false};
@@ -49,6 +49,11 @@ struct matmul_executable_t : public op_executable_t {
 
     bool is_initialized() const override { return bool(prim_); }
 
+    std::vector<int> get_prefetch_args() const override {
+        if (is_dummy_) return {};
+        return {DNNL_ARG_WEIGHTS};
+    }
+
 private:
     dnnl::matmul prim_;
     bool with_sum_ {false};
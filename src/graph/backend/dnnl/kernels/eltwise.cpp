@@ -168,9 +168,16 @@ status_t eltwise_fwd_t<quantized>::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
         } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
+            const size_t persistent_key = encode_persistent_constant_key(
+                    inputs, const_md_hash_);
+            c_buffer = map_persisted_constant_buffer(persistent_key,
+                    memory_planner_.total_internal_persistent_size());
+            const bool is_from_store = static_cast<bool>(c_buffer);
+            if (!is_from_store) {
+                c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                        memory_planner_.total_internal_persistent_size(),
+                        p_engine_, g_alloc_);
+            }
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
                     c_buffer->data<char>());
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
@@ -178,10 +185,13 @@ status_t eltwise_fwd_t<quantized>::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
+            if (!is_from_store) {
+                for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                    if (!subgraph_->is_constant_[i]) continue;
+                    subgraph_->execs_[i]->execute(
+                            p_stream, res->get_exec_args()[i]);
+                }
+                persist_constant_buffer(p_stream, persistent_key, c_buffer);
             }
 
             c_promise.set_value(c_buffer);
@@ -56,6 +56,42 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+size_t kernel_base_t::encode_persistent_constant_key(
+        const std::vector<tensor_t> &inputs, size_t cache_key) const {
+    if (!p_engine_.get(true)
+            || !constant_tensor_store_t::get_instance().is_enabled(
+                    p_engine_.get()))
+        return 0;
+
+    size_t key = cache_key;
+    for (const auto &in : inputs) {
+        logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+        if (!ltw.is_constant()) continue;
+        key = hash_combine(key,
+                constant_tensor_store_t::fingerprint(
+                        in.get_data_handle(), ltw.size()));
+    }
+    // Reserve 0 for the disabled store
+    return key ? key : 1;
+}
+
+std::shared_ptr<constant_buffer_t>
+kernel_base_t::map_persisted_constant_buffer(
+        size_t persistent_key, size_t size) const {
+    if (persistent_key == 0) return nullptr;
+    return constant_tensor_store_t::get_instance().map(
+            persistent_key, size, p_engine_.get());
+}
+
+void kernel_base_t::persist_constant_buffer(dnnl::stream &p_stream,
+        size_t persistent_key,
+        const std::shared_ptr<constant_buffer_t> &buffer) const {
+    if (persistent_key == 0 || !buffer) return;
+    // Constant tensors may still be computed asynchronously
+    p_stream.wait();
+    constant_tensor_store_t::get_instance().save(persistent_key, *buffer);
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 }
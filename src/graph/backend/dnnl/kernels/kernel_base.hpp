@@ -34,6 +34,9 @@
 namespace dnnl {
 namespace impl {
 namespace graph {
+
+class constant_buffer_t;
+
 namespace dnnl_impl {
 
 class dnnl_partition_impl_t;
@@ -106,6 +109,18 @@ struct kernel_base_t {
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // Helpers for the on-disk constant tensor store. Unlike the in-memory
+    // cache key, the persistent key is derived from the content of the
+    // constant inputs. It is 0 when the store is disabled, in which case
+    // nothing is mapped or persisted.
+    size_t encode_persistent_constant_key(
+            const std::vector<tensor_t> &inputs, size_t cache_key) const;
+    std::shared_ptr<constant_buffer_t> map_persisted_constant_buffer(
+            size_t persistent_key, size_t size) const;
+    void persist_constant_buffer(dnnl::stream &p_stream,
+            size_t persistent_key,
+            const std::shared_ptr<constant_buffer_t> &buffer) const;
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
 protected:
@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "graph/backend/dnnl/executables/base.hpp"
+#include "graph/backend/dnnl/weight_prefetcher.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+// The helper thread checks for cancellation once per chunk
+constexpr size_t prefetch_chunk_size = 4096;
+constexpr size_t cache_line_size = 64;
+} // namespace
+
+weight_prefetcher_t *weight_prefetcher_t::get(const dnnl::engine &p_engine) {
+    if (p_engine.get_kind() != dnnl::engine::kind::cpu
+            || !is_native_runtime(p_engine.get()->runtime_kind()))
+        return nullptr;
+
+    static const bool enabled
+            = impl::getenv_int_user("GRAPH_WEIGHT_PREFETCH", 0) > 0;
+    if (!enabled) return nullptr;
+
+    static weight_prefetcher_t instance([]() {
+        size_t llc_size = static_cast<size_t>(
+                                  cpu::platform::get_per_core_cache_size(3))
+                * cpu::platform::get_num_cores();
+        if (llc_size == 0)
+            llc_size = static_cast<size_t>(
+                               cpu::platform::get_per_core_cache_size(2))
+                    * cpu::platform::get_num_cores();
+        return llc_size / 2;
+    }());
+    return instance.budget() ? &instance : nullptr;
+}
+
+weight_prefetcher_t::weight_prefetcher_t(size_t budget)
+    : budget_(budget), worker_([this]() { worker_loop(); }) {}
+
+weight_prefetcher_t::~weight_prefetcher_t() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        generation_++;
+    }
+    cv_.notify_all();
+    worker_.join();
+}
+
+void weight_prefetcher_t::prefetch(const op_executable_t &exec,
+        const std::unordered_map<int, memory> &args) {
+    std::vector<std::pair<const char *, size_t>> regions;
+    size_t total = 0;
+    for (int arg : exec.get_prefetch_args()) {
+        auto it = args.find(arg);
+        if (it == args.end() || !it->second) continue;
+        const char *ptr
+                = static_cast<const char *>(it->second.get_data_handle());
+        size_t size = std::min(
+                it->second.get_desc().get_size(), budget_ - total);
+        if (!ptr || size == 0) continue;
+        regions.emplace_back(ptr, size);
+        total += size;
+        if (total == budget_) break;
+    }
+    if (regions.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        regions_ = std::move(regions);
+        generation_++;
+    }
+    cv_.notify_all();
+}
+
+void weight_prefetcher_t::cancel() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    regions_.clear();
+    generation_++;
+    cv_.wait(lock, [this]() { return !is_busy_; });
+}
+
+void weight_prefetcher_t::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stop_ || !regions_.empty(); });
+        if (stop_) break;
+
+        auto regions = std::move(regions_);
+        regions_.clear();
+        const size_t generation = generation_;
+        is_busy_ = true;
+
+        bool is_cancelled = false;
+        for (const auto &r : regions) {
+            for (size_t off = 0; off < r.second && !is_cancelled;
+                    off += prefetch_chunk_size) {
+                lock.unlock();
+                // Touch every cache line of the chunk. The loads bring the
+                // lines into the shared last level cache.
+                const size_t end
+                        = std::min(r.second, off + prefetch_chunk_size);
+                unsigned char acc = 0;
+                for (size_t i = off; i < end; i += cache_line_size)
+                    acc ^= reinterpret_cast<const volatile unsigned char *>(
+                            r.first)[i];
+                MAYBE_UNUSED(acc);
+                lock.lock();
+                is_cancelled = generation != generation_;
+            }
+            if (is_cancelled) break;
+        }
+
+        is_busy_ = false;
+        cv_.notify_all();
+    }
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_WEIGHT_PREFETCHER_HPP
+#define GRAPH_BACKEND_DNNL_WEIGHT_PREFETCHER_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+struct op_executable_t;
+
+// Streams the weights of the next executable into the last level cache on a
+// helper thread while the current executable computes. It is enabled on CPU
+// by setting ONEDNN_GRAPH_WEIGHT_PREFETCH=1.
+//
+// Only one request is in flight: a new request cancels the previous one. The
+// amount of prefetched data per request is limited by a budget of half of the
+// last level cache, so the prefetched lines do not evict the working set of
+// the executable that is currently running.
+class weight_prefetcher_t {
+public:
+    // Returns nullptr when prefetching is disabled or not supported for the
+    // engine.
+    static weight_prefetcher_t *get(const dnnl::engine &p_engine);
+
+    ~weight_prefetcher_t();
+
+    // Requests to prefetch the arguments of `exec` returned by
+    // op_executable_t::get_prefetch_args().
+    void prefetch(const op_executable_t &exec,
+            const std::unordered_map<int, memory> &args);
+
+    // Cancels the pending request and blocks until the helper thread stops
+    // reading memory. Must be called before the prefetched memory may be
+    // released, e.g. at the end of partition execution.
+    void cancel();
+
+    size_t budget() const { return budget_; }
+
+private:
+    weight_prefetcher_t(size_t budget);
+
+    void worker_loop();
+
+    size_t budget_;
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    // Regions of the current request as <pointer, size> pairs
+    std::vector<std::pair<const char *, size_t>> regions_;
+    // Incremented by every request, so the helper thread can detect that the
+    // request it works on is outdated
+    size_t generation_ = 0;
+    bool is_busy_ = false;
+    bool stop_ = false;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -15,12 +15,16 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
 #include "common/engine.hpp"
+#include "common/memory_usage.hpp"
+#include "common/trace.hpp"
 #include "common/utils.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -43,6 +47,16 @@
 #include <windows.h>
 #endif
 
+#if defined __unix__ || defined __APPLE__ || defined __FreeBSD__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define DNNL_GRAPH_CONSTANT_TENSOR_STORE_SUPPORTED 1
+#else
+#define DNNL_GRAPH_CONSTANT_TENSOR_STORE_SUPPORTED 0
+#endif
+
 namespace std {
 template <>
 struct hash<dnnl::impl::engine_kind_t> {
@@ -173,6 +187,9 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
     auto e = get(key);
     if (e.valid()) {
         unlock_read();
+        if (trace::is_enabled())
+            trace::add_instant("graph", "constant_cache_hit",
+                    "size:" + std::to_string(size));
         return e;
     }
 
@@ -198,6 +215,10 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
         add(key, size, value);
     }
     unlock_write();
+    if (trace::is_enabled())
+        trace::add_instant("graph",
+                e.valid() ? "constant_cache_hit" : "constant_cache_miss",
+                "size:" + std::to_string(size));
     return e;
 }
 
@@ -237,6 +258,10 @@ void constant_tensor_cache_t::add(
     // directly
     if (current_size + size > capacity_in_bytes_) { return; }
 
+    // Make room for the new tensor if it exceeds the library memory budget
+    const size_t excess = memory_usage::budget_excess(size);
+    if (excess) evict(std::min(excess, current_size));
+
     // Cache tensors
     size_t timestamp = get_timestamp();
 
@@ -287,6 +312,156 @@ void constant_tensor_cache_t::evict(size_t n) {
     }
 }
 
+mapped_constant_buffer_t::~mapped_constant_buffer_t() {
+#if DNNL_GRAPH_CONSTANT_TENSOR_STORE_SUPPORTED
+    munmap(base_, mapped_size_);
+#endif
+}
+
+namespace {
+// Every file starts with a header padded to the page size, so the payload
+// mapping keeps the alignment expected by primitives.
+constexpr size_t store_header_size = 4096;
+constexpr uint64_t store_magic = 0x31534e4f43474e44ULL; // "DNGCONS1"
+
+struct store_header_t {
+    uint64_t magic;
+    uint64_t key;
+    uint64_t size;
+};
+} // namespace
+
+constant_tensor_store_t &constant_tensor_store_t::get_instance() {
+    static constant_tensor_store_t instance;
+    return instance;
+}
+
+constant_tensor_store_t::constant_tensor_store_t() {
+#if DNNL_GRAPH_CONSTANT_TENSOR_STORE_SUPPORTED
+    std::string dir
+            = impl::getenv_string_user("GRAPH_CONSTANT_TENSOR_CACHE_DIR");
+    if (dir.empty()) return;
+
+    struct stat st;
+    if (stat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+        VERROR(graph, constant_tensor_cache,
+                "'%s' is not a directory, on-disk constant tensor store is "
+                "disabled",
+                dir.c_str());
+        return;
+    }
+    if (dir.back() != '/') dir += '/';
+    dir_ = dir;
+#endif
+}
+
+bool constant_tensor_store_t::is_enabled(const impl::engine_t *eng) const {
+    return !dir_.empty() && eng && eng->kind() == impl::engine_kind::cpu;
+}
+
+std::string constant_tensor_store_t::get_path(key_t key, size_t size) const {
+    char name[64];
+    snprintf(name, sizeof(name), "%016zx_%zu.bin", key, size);
+    return dir_ + name;
+}
+
+constant_tensor_store_t::cached_t constant_tensor_store_t::map(
+        key_t key, size_t size, impl::engine_t *eng) const {
+#if DNNL_GRAPH_CONSTANT_TENSOR_STORE_SUPPORTED
+    if (!is_enabled(eng) || size == 0) return nullptr;
+
+    const std::string path = get_path(key, size);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    const size_t file_size = store_header_size + size;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != file_size) {
+        close(fd);
+        return nullptr;
+    }
+
+    void *base = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (base == MAP_FAILED) return nullptr;
+
+    store_header_t header;
+    std::memcpy(&header, base, sizeof(header));
+    if (header.magic != store_magic || header.key != key
+            || header.size != size) {
+        munmap(base, file_size);
+        return nullptr;
+    }
+
+    return std::make_shared<mapped_constant_buffer_t>(
+            base, file_size, store_header_size, size, eng);
+#else
+    UNUSED(key);
+    UNUSED(size);
+    UNUSED(eng);
+    return nullptr;
+#endif
+}
+
+void constant_tensor_store_t::save(
+        key_t key, const constant_buffer_t &buffer) const {
+#if DNNL_GRAPH_CONSTANT_TENSOR_STORE_SUPPORTED
+    const size_t size = buffer.size();
+    if (dir_.empty() || size == 0) return;
+
+    // Write into a process-private file first and publish it with an atomic
+    // rename, so concurrent readers never observe a partially written entry.
+    const std::string path = get_path(key, size);
+    const std::string tmp_path = path + "." + std::to_string(getpid());
+    int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) return;
+
+    auto write_all = [&](const char *ptr, size_t len) {
+        while (len > 0) {
+            ssize_t written = write(fd, ptr, len);
+            if (written <= 0) return false;
+            ptr += written;
+            len -= static_cast<size_t>(written);
+        }
+        return true;
+    };
+
+    std::vector<char> header_page(store_header_size, 0);
+    store_header_t header {store_magic, key, size};
+    std::memcpy(header_page.data(), &header, sizeof(header));
+
+    bool ok = write_all(header_page.data(), header_page.size())
+            && write_all(buffer.data<char>(), size);
+    ok = close(fd) == 0 && ok;
+    if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+        VERROR(graph, constant_tensor_cache,
+                "failed to persist constant tensor to '%s'", path.c_str());
+        unlink(tmp_path.c_str());
+    }
+#else
+    UNUSED(key);
+    UNUSED(buffer);
+#endif
+}
+
+size_t constant_tensor_store_t::fingerprint(const void *data, size_t size) {
+    // 64-bit FNV-1a over 8-byte words followed by the tail bytes. It is only
+    // used to tell different constant inputs apart, not for security.
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    uint64_t h = 0xcbf29ce484222325ULL ^ size;
+    const char *ptr = static_cast<const char *>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t w;
+        std::memcpy(&w, ptr + i, sizeof(w));
+        h = (h ^ w) * prime;
+    }
+    for (; i < size; i++)
+        h = (h ^ static_cast<uint8_t>(ptr[i])) * prime;
+    return static_cast<size_t>(h);
+}
+
 // copy from src/common/engine.cpp
 static std::unique_ptr<impl::engine_factory_t> get_engine_factory(
         impl::engine_kind_t kind, impl::runtime_kind_t runtime_kind) {
@@ -26,6 +26,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
+#include "common/memory_usage.hpp"
 #include "common/rw_mutex.hpp"
 
 #include "graph/interface/allocator.hpp"
@@ -50,10 +51,19 @@ public:
         , free_func_(free_func) {
         data_ = malloc_func_(size, eng, alc);
         eng_->retain();
+        if (data_)
+            impl::memory_usage::add(impl::memory_usage::kind_t::constant_cache,
+                    eng_->kind(), size_);
     }
 
     virtual ~constant_buffer_t() {
-        free_func_(data_, eng_, alc_);
+        if (free_func_) {
+            free_func_(data_, eng_, alc_);
+            if (data_)
+                impl::memory_usage::sub(
+                        impl::memory_usage::kind_t::constant_cache,
+                        eng_->kind(), size_);
+        }
         eng_->release();
     }
 
@@ -75,6 +85,18 @@ public:
     virtual void notify_evict() {}
 
 protected:
+    // Wraps memory owned by a derived class, which is responsible for
+    // releasing it
+    constant_buffer_t(void *data, size_t size, impl::engine_t *eng)
+        : data_(data)
+        , size_(size)
+        , eng_(eng)
+        , alc_(nullptr)
+        , malloc_func_(nullptr)
+        , free_func_(nullptr) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
@@ -85,6 +107,60 @@ private:
     free_func_t free_func_;
 };
 
+// A read-only view of a constant buffer persisted on disk by
+// constant_tensor_store_t. The pages are backed by the file, so all processes
+// mapping the same entry share a single physical copy.
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    mapped_constant_buffer_t(void *base, size_t mapped_size, size_t offset,
+            size_t size, impl::engine_t *eng)
+        : constant_buffer_t(static_cast<char *>(base) + offset, size, eng)
+        , base_(base)
+        , mapped_size_(mapped_size) {}
+
+    ~mapped_constant_buffer_t() override;
+
+private:
+    void *base_;
+    size_t mapped_size_;
+};
+
+// Optional on-disk backing store for constant buffers. It is enabled by
+// setting ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR to an existing directory and
+// is only supported for CPU engines on POSIX systems. Each entry is written
+// once by the process that computed it and then memory-mapped read-only by
+// later processes, so they can skip re-computation of the constant tensors.
+//
+// Since the keys are persisted across processes, they must not depend on
+// process-specific values such as data pointers. Backends should combine the
+// layout hash of the cached buffer with fingerprint() of the constant inputs.
+struct constant_tensor_store_t {
+    using key_t = size_t;
+    using cached_t = std::shared_ptr<constant_buffer_t>;
+
+    static constant_tensor_store_t &get_instance();
+
+    bool is_enabled(const impl::engine_t *eng) const;
+
+    // Returns a read-only mapping of the entry or nullptr if there is no
+    // valid entry of the requested size.
+    cached_t map(key_t key, size_t size, impl::engine_t *eng) const;
+
+    // Persists the content of the buffer. Failures are not fatal since the
+    // store is only an optimization, they are reported in verbose instead.
+    void save(key_t key, const constant_buffer_t &buffer) const;
+
+    // Content based hash of a host memory region
+    static size_t fingerprint(const void *data, size_t size);
+
+private:
+    constant_tensor_store_t();
+
+    std::string get_path(key_t key, size_t size) const;
+
+    std::string dir_;
+};
+
 struct constant_tensor_cache_t {
     using key_t = size_t;
     using cached_t = std::shared_ptr<constant_buffer_t>;
@@ -29,6 +29,7 @@
 
 #include "common/cache_hit_types.hpp"
 #include "common/stream.hpp"
+#include "common/trace.hpp"
 #include "common/verbose.hpp"
 
 #include "graph/interface/allocator.hpp"
@@ -202,6 +203,9 @@ status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
     std::pair<compiled_partition_t *, cache_state_t> cp {
             compiled_partition, cache_state_t::compiled_partition_hit};
 
+    const double trace_start_us = dnnl::impl::trace::is_enabled()
+            ? dnnl::impl::trace::now_us()
+            : 0.;
     if (get_verbose(dnnl::impl::verbose_t::create_profile,
                 dnnl::impl::component_t::graph)) {
         double start_ms = dnnl::impl::get_msec();
@@ -214,6 +218,11 @@ status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
     } else {
         CHECK(partition->compile(cp, in, out, engine));
     }
+    if (dnnl::impl::trace::is_enabled())
+        dnnl::impl::trace::add_span("graph_compile", "compile",
+                trace_start_us, dnnl::impl::trace::now_us(),
+                std::string(cache_state2str(cp.second)) + ","
+                        + compiled_partition->info());
     return status::success;
 }
 
@@ -320,6 +329,9 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
         outs.emplace_back(**(outputs + i));
     }
 
+    const double trace_start_us = dnnl::impl::trace::is_enabled()
+            ? dnnl::impl::trace::now_us()
+            : 0.;
     if (get_verbose(dnnl::impl::verbose_t::exec_profile,
                 dnnl::impl::component_t::graph)) {
         bool block_on_wait = true;
@@ -341,6 +353,9 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
     } else {
         CHECK(compiled_partition->execute(stream, ins, outs));
     }
+    if (dnnl::impl::trace::is_enabled())
+        dnnl::impl::trace::add_span("graph_exec", "execute", trace_start_us,
+                dnnl::impl::trace::now_us(), compiled_partition->info());
     return status::success;
 }
 
@@ -42,6 +42,7 @@
 #include "prelu/prelu.hpp"
 #include "reduction/reduction.hpp"
 #include "reorder/reorder.hpp"
+#include "replay/replay.hpp"
 #include "resampling/resampling.hpp"
 #include "rnn/rnn.hpp"
 #include "self/self.hpp"
@@ -143,6 +144,8 @@ int main(int argc, char **argv) {
         reduction::bench(--argc, ++argv);
     } else if (!strcmp("--zeropad", argv[0])) {
         zeropad::bench(--argc, ++argv);
+    } else if (!strcmp("--replay", argv[0])) {
+        replay::bench(--argc, ++argv);
     } else if (!strcmp("--brgemm", argv[0])) {
         brgemm::bench(--argc, ++argv);
         brgemm::brgemm_finalize();
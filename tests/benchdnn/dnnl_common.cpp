@@ -15,16 +15,22 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <atomic>
 #include <functional> // for std::bind and std::placeholders
 #include <future> // for std::promise and std::future
 #include <list>
 #include <numeric>
 #include <string> // for std::string
+#include <thread>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -53,6 +59,7 @@
 #include "utils/cold_cache.hpp"
 #include "utils/dnnl_query.hpp"
 #include "utils/fill.hpp"
+#include "utils/replay.hpp"
 #include "utils/stream_kind.hpp"
 
 extern "C" dnnl_status_t dnnl_impl_notify_profiling_complete(
@@ -355,6 +362,8 @@ memory_kind_ext_t memory_kind {default_memory_kind};
 
 int default_num_streams = 1;
 int num_streams = default_num_streams;
+int default_num_instances = 1;
+int num_instances = default_num_instances;
 
 void init_isa_settings() {
     if (hints.get() == isa_hints_t::no_hints) {
@@ -784,20 +793,120 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     return OK;
 }
 
+// Splits the cores available to the process into `n` disjoint sets of
+// consecutive cores. Returns an empty vector if the affinity is unknown.
+static std::vector<std::vector<int>> get_instances_cores(int n) {
+    std::vector<int> cores;
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        for (int core = 0; core < CPU_SETSIZE; core++)
+            if (CPU_ISSET(core, &mask)) cores.push_back(core);
+    }
+#endif
+    const int ncores = static_cast<int>(cores.size());
+    if (ncores < n) return {};
+
+    std::vector<std::vector<int>> instances_cores(n);
+    for (int i = 0; i < n; i++) {
+        const int begin = i * ncores / n;
+        const int end = (i + 1) * ncores / n;
+        instances_cores[i].assign(cores.begin() + begin, cores.begin() + end);
+    }
+    return instances_cores;
+}
+
+// Runs the instances concurrently, each from its own thread. All instances
+// stop once one of them meets the stop criterion, so that every measurement
+// is taken under the contention for memory bandwidth and caches.
+inline int measure_perf_instances(std::vector<timer::timer_t> &v_t,
+        timer::timer_t &throughput_t, const std::vector<stream_t> &v_stream,
+        perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
+    const size_t n = v_stream.size();
+    std::vector<cold_cache_t> cold_cache(n);
+    for (size_t j = 0; j < n; j++) {
+        // Warm-up run.
+        DNN_SAFE(perf_func(v_stream[j], dnnl_args[j]), WARN);
+        DNN_SAFE(dnnl_stream_wait(v_stream[j]), CRIT);
+        cold_cache[j] = cold_cache_t(dnnl_args[j], v_stream[j]);
+    }
+
+    std::atomic<bool> stop(false);
+    std::vector<int> v_ret(n, OK);
+    std::vector<std::thread> threads;
+    throughput_t.reset();
+    for (size_t j = 0; j < n; j++) {
+        threads.emplace_back([&, j]() {
+            auto &t = v_t[j];
+            t.reset();
+            while (!stop) {
+                if (!cold_cache[j].update_dnnl_args(dnnl_args[j])) break;
+                t.start();
+                if (perf_func(v_stream[j], dnnl_args[j]) != dnnl_success) {
+                    v_ret[j] = FAIL;
+                    stop = true;
+                    break;
+                }
+                t.stamp();
+                if (should_stop(t)) stop = true;
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    int times = 0;
+    for (const auto &t : v_t)
+        times += t.times();
+    throughput_t.stamp(times);
+
+    for (size_t j = 0; j < n; j++)
+        if (v_ret[j] != OK) return v_ret[j];
+    return OK;
+}
+
 int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         args_t &args) {
     if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
 
     const auto &engine = get_test_engine();
-    std::vector<stream_t> v_stream(num_streams);
-    for (int i = 0; i < num_streams; i++)
-        v_stream[i] = stream_t(engine, ctx.get_interop_obj());
 
-    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(num_streams);
-    std::vector<dnn_mem_map_t> mem_map(num_streams);
-    std::vector<args_t> v_args(num_streams);
+    // Instances of a problem run on dedicated cores with their own copies of
+    // the memories, the same way as streams do.
+    const bool use_instances = num_instances > 1;
+    std::vector<std::vector<int>> instances_cores;
+    if (use_instances) {
+        if (!is_cpu(engine) || is_async(engine) || num_streams > 1) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Error: multiple instances are supported for CPU with "
+                    "synchronous runtimes and a single stream only.");
+            return FAIL;
+        }
+        instances_cores = get_instances_cores(num_instances);
+        if (instances_cores.empty()) {
+            BENCHDNN_PRINT(0,
+                    "Error: can't assign disjoint cores to %d instances.\n",
+                    num_instances);
+            return FAIL;
+        }
+    }
+
+    const int ncopies = use_instances ? num_instances : num_streams;
+    std::vector<stream_t> v_stream(ncopies);
+    for (int i = 0; i < ncopies; i++) {
+        if (use_instances)
+            v_stream[i] = stream_t(engine, instances_cores[i]);
+        else
+            v_stream[i] = stream_t(engine, ctx.get_interop_obj());
+    }
+
+    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(ncopies);
+    std::vector<dnn_mem_map_t> mem_map(ncopies);
+    std::vector<args_t> v_args(ncopies);
     v_args[0] = args;
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < ncopies; j++) {
         for (int i = 0; i < args.size(); i++) {
             int arg = args.arg(i);
             const auto &m = args.dnn_mem(i);
@@ -817,8 +926,26 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // For DPCPP CPU and GPU: measure iterations in batches to hide driver
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     // For async threadpool CPU: use aggregate as well, similar to DPCPP CPU.
+    // For multiple instances: measure individual iterations of each instance.
     int ret = OK;
-    if (is_async(engine)) {
+    if (use_instances) {
+        std::vector<timer::timer_t> v_t(ncopies);
+        auto &throughput_t
+                = res->timer_map.get_timer(timer::names::throughput_timer);
+        ret = measure_perf_instances(
+                v_t, throughput_t, v_stream, perf_func, dnnl_args);
+        t.reset();
+        for (int j = 0; j < ncopies; j++) {
+            t.merge(v_t[j]);
+            BENCHDNN_PRINT(1,
+                    "[INSTANCE %d] cores:%d-%d times:%d min:%g p50:%g "
+                    "p99:%g max:%g\n",
+                    j, instances_cores[j].front(), instances_cores[j].back(),
+                    v_t[j].times(), v_t[j].ms(timer::timer_t::min),
+                    v_t[j].percentile(50), v_t[j].percentile(99),
+                    v_t[j].ms(timer::timer_t::max));
+        }
+    } else if (is_async(engine)) {
         ret = execute_in_thr_ctx(
                 ctx, measure_perf_aggregate, t, v_stream, perf_func, dnnl_args);
     } else {
@@ -828,7 +955,7 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
 
     res->state = (ret == OK ? EXECUTED : FAILED);
     execute_map_args(args);
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < ncopies; j++) {
         execute_map_args(v_args[j]);
     }
 
@@ -837,6 +964,10 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
 
 int measure_perf(
         const thr_ctx_t &ctx, res_t *res, dnnl_primitive_t prim, args_t &args) {
+    if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
+    // The replay driver times the primitive later as a part of the sequence.
+    if (replay::is_recording()) return replay::record(ctx, res, prim, args);
+
     perf_function_t perf_func = std::bind(&primitive_executor, prim,
             std::placeholders::_1, std::placeholders::_2);
 
@@ -1883,6 +2014,13 @@ stream_t::stream_t(dnnl_engine_t engine, void *interop_obj) : is_owner_(true) {
     DNN_SAFE_V(dnnl_stream_create(&stream_, engine, flags));
 }
 
+stream_t::stream_t(dnnl_engine_t engine, const std::vector<int> &cores)
+    : is_owner_(true) {
+    DNN_SAFE_V(dnnl_stream_create_with_cpu_affinity(&stream_, engine,
+            dnnl_stream_in_order, static_cast<int>(cores.size()),
+            cores.data()));
+}
+
 stream_t::~stream_t() {
     if (is_owner_) DNN_SAFE_V(dnnl_stream_destroy(stream_));
 }
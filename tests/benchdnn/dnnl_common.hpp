@@ -96,6 +96,8 @@ extern size_t engine_index;
 extern isa_hints_t hints;
 extern int default_num_streams;
 extern int num_streams;
+extern int default_num_instances;
+extern int num_instances;
 
 struct engine_t {
     engine_t(dnnl_engine_kind_t engine_kind);
@@ -114,6 +116,8 @@ private:
 struct stream_t {
     stream_t() : stream_(nullptr), is_owner_(false) {}
     stream_t(dnnl_engine_t engine, void *interop_obj = nullptr);
+    // Creates a CPU stream executing primitives on threads pinned to `cores`.
+    stream_t(dnnl_engine_t engine, const std::vector<int> &cores);
     ~stream_t();
     operator dnnl_stream_t() const { return stream_; }
     stream_t &operator=(stream_t &&rhs);
@@ -0,0 +1,192 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "dnnl_common.hpp"
+#include "utils/parser.hpp"
+
+#include "binary/binary.hpp"
+#include "bnorm/bnorm.hpp"
+#include "concat/concat.hpp"
+#include "conv/conv.hpp"
+#include "deconv/deconv.hpp"
+#include "eltwise/eltwise.hpp"
+#include "gnorm/gnorm.hpp"
+#include "ip/ip.hpp"
+#include "lnorm/lnorm.hpp"
+#include "lrn/lrn.hpp"
+#include "matmul/matmul.hpp"
+#include "pool/pool.hpp"
+#include "prelu/prelu.hpp"
+#include "reduction/reduction.hpp"
+#include "reorder/reorder.hpp"
+#include "resampling/resampling.hpp"
+#include "rnn/rnn.hpp"
+#include "shuffle/shuffle.hpp"
+#include "softmax/softmax.hpp"
+#include "sum/sum.hpp"
+
+#include "replay/replay.hpp"
+
+namespace replay {
+
+namespace {
+
+// Drivers executing a single library primitive per problem.
+bench_f get_driver_bench(const std::string &name) {
+    static const std::vector<std::pair<std::string, bench_f>> drivers = {
+            {"--binary", binary::bench},
+            {"--bnorm", bnorm::bench},
+            {"--concat", concat::bench},
+            {"--conv", conv::bench},
+            {"--deconv", deconv::bench},
+            {"--eltwise", eltwise::bench},
+            {"--gnorm", gnorm::bench},
+            {"--ip", ip::bench},
+            {"--lnorm", lnorm::bench},
+            {"--lrn", lrn::bench},
+            {"--matmul", matmul::bench},
+            {"--pool", pool::bench},
+            {"--prelu", prelu::bench},
+            {"--reduction", reduction::bench},
+            {"--reorder", reorder::bench},
+            {"--resampling", resampling::bench},
+            {"--rnn", rnn::bench},
+            {"--shuffle", shuffle::bench},
+            {"--softmax", softmax::bench},
+            {"--sum", sum::bench},
+    };
+    for (const auto &d : drivers)
+        if (d.first == name) return d.second;
+    return nullptr;
+}
+
+// Reads problem lines of the form `--DRIVER [OPTIONS] DESC`, one primitive
+// per line, skipping empty lines and comments.
+int read_sequence(
+        const char *fname, std::vector<std::vector<std::string>> &sequence) {
+    std::ifstream ifs(locate_file(std::string(fname)));
+    if (!ifs.is_open()) {
+        BENCHDNN_PRINT(0, "Error: can't open the file \'%s\'.\n", fname);
+        return FAIL;
+    }
+
+    std::string line;
+    while (std::getline(ifs, line)) {
+        std::istringstream ss(line);
+        std::vector<std::string> tokens;
+        std::string token;
+        while (ss >> token)
+            tokens.push_back(token);
+        if (tokens.empty() || tokens.front().front() == '#') continue;
+        if (tokens.size() < 2 || !get_driver_bench(tokens.front())) {
+            BENCHDNN_PRINT(0,
+                    "Error: can't replay the line \'%s\'. Only single "
+                    "primitive drivers are supported.\n",
+                    line.c_str());
+            return FAIL;
+        }
+        sequence.push_back(std::move(tokens));
+    }
+    return OK;
+}
+
+int record_sequence(
+        const std::vector<std::vector<std::string>> &sequence, int nthr) {
+    const std::string ctx_str = std::to_string(nthr);
+    for (const auto &tokens : sequence) {
+        // Threading knobs are placed right before the problem descriptor so
+        // that `--reset` in the line doesn't drop them.
+        std::vector<std::string> opts(tokens.begin() + 1, tokens.end() - 1);
+        if (nthr > 0) {
+            opts.push_back("--ctx-init=" + ctx_str);
+            opts.push_back("--ctx-exe=" + ctx_str);
+        }
+        opts.push_back(tokens.back());
+
+        std::string label;
+        for (const auto &t : tokens)
+            label += (label.empty() ? "" : " ") + t;
+        set_label(label);
+
+        std::vector<char *> c_opts;
+        for (auto &opt : opts)
+            c_opts.push_back(const_cast<char *>(opt.c_str()));
+        SAFE(get_driver_bench(tokens.front())(
+                     static_cast<int>(c_opts.size()), c_opts.data()),
+                WARN);
+    }
+    driver_name = "replay";
+    return OK;
+}
+
+int replay_file(const settings_t &s, const char *fname) {
+    if (!has_bench_mode_bit(mode_bit_t::perf)) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: the replay driver supports performance mode only.");
+        return FAIL;
+    }
+
+    std::vector<std::vector<std::string>> sequence;
+    SAFE(read_sequence(fname, sequence), WARN);
+
+    for (int nthr : s.nthr) {
+        set_recording(true);
+        const int status = record_sequence(sequence, nthr);
+        set_recording(false);
+
+        if (status == OK) {
+            const std::string title = std::string(fname) + " nthr:"
+                    + (nthr > 0 ? std::to_string(nthr) : "auto");
+            SAFE(run(title), WARN);
+        }
+        clear();
+        SAFE(status, WARN);
+    }
+    return OK;
+}
+
+} // namespace
+
+int bench(int argc, char **argv) {
+    driver_name = "replay";
+    using namespace parser;
+    static settings_t s;
+    static const settings_t def {};
+    static const std::string help_nthr
+            = "N1[,N2,...]    (Default: `0`)\n    Replays the sequence with "
+              "each number of threads `Ni`.\n    `0` stands for the default "
+              "number of threads.\n";
+    for (; argc > 0; --argc, ++argv) {
+        const bool parsed_options = parse_bench_settings(argv[0])
+                || parse_vector_option(s.nthr, def.nthr, atoi, argv[0], "nthr",
+                        help_nthr)
+                || parse_reset(s, argv[0]) || parse_help(argv[0]);
+        if (!parsed_options) {
+            catch_unknown_options(argv[0]);
+
+            SAFE(replay_file(s, argv[0]), CRIT);
+        }
+    }
+
+    return parse_last_argument();
+}
+
+} // namespace replay
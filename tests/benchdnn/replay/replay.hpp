@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <vector>
+
+#include "common.hpp"
+#include "utils/replay.hpp"
+
+namespace replay {
+
+struct settings_t {
+    settings_t() = default;
+
+    // Number of threads to replay the sequence with. `0` stands for the
+    // default number of threads.
+    std::vector<int> nthr {0};
+
+    void reset() { *this = settings_t(); }
+};
+
+int bench(int argc, char **argv);
+
+} // namespace replay
+
+#endif
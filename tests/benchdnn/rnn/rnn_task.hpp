@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "common.hpp"
+#include "utils/replay.hpp"
 
 template <typename prb_t, typename perf_report_t, typename create_func_t,
         typename check_cache_func_t, typename do_func_t>
@@ -108,7 +109,7 @@ private:
     int report() {
         const prb_t *prb = prb_.get();
         parse_result(res_, prb->str());
-        if (has_bench_mode_bit(mode_bit_t::perf)) {
+        if (has_bench_mode_bit(mode_bit_t::perf) && !replay::is_recording()) {
             perf_report_t pr(prb, perf_template_.c_str());
             pr.report(&res_, prb->str());
         }
@@ -22,6 +22,7 @@
 #include "utils/cold_cache.hpp"
 #include "utils/fill.hpp"
 #include "utils/parser.hpp"
+#include "utils/roofline.hpp"
 #include "utils/stream_kind.hpp"
 #include "utils/summary.hpp"
 
@@ -1587,6 +1588,54 @@ static bool parse_num_streams(
     return parsed;
 }
 
+static bool parse_num_instances(
+        const char *str, const std::string &option_name = "num-instances") {
+    static const std::string help
+            = "N    (Default: `1`)\n    Specifies the number `N` of "
+              "instances of a problem executed concurrently on disjoint sets "
+              "of cores for performance benchmarking.\n    `N` is a positive "
+              "integer.\n";
+    bool parsed = parse_single_value_option(num_instances,
+            default_num_instances, utils::stoll_safe, str, option_name, help);
+    if (parsed) {
+        if (num_instances <= 0) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Error: number of instances must be positive.");
+            SAFE_V(FAIL);
+        }
+    }
+    return parsed;
+}
+
+static bool parse_peak_gbps(
+        const char *str, const std::string &option_name = "peak-gbps") {
+    static const std::string help
+            = "FLOAT    (Default: `0`)\n    Specifies the peak memory "
+              "bandwidth in GB/s used by the roofline model of the "
+              "performance report.\n    If `FLOAT` is `0`, the bandwidth is "
+              "measured on the machine for CPU.\n    More details at "
+            + doc_url + "knobs_perf_report.md\n";
+    bool parsed = parse_single_value_option(peak_gbps, default_peak_gbps,
+            utils::stof_safe, str, option_name, help);
+    if (parsed) peak_gbps = MAX2(0., peak_gbps);
+    return parsed;
+}
+
+static bool parse_peak_gflops(
+        const char *str, const std::string &option_name = "peak-gflops") {
+    static const std::string help
+            = "FLOAT    (Default: `0`)\n    Specifies the peak compute in "
+              "GFLOPS used by the roofline model of the performance "
+              "report.\n    If `FLOAT` is `0`, the peak is estimated for the "
+              "effective ISA and data type on the machine for CPU.\n    More "
+              "details at "
+            + doc_url + "knobs_perf_report.md\n";
+    bool parsed = parse_single_value_option(peak_gflops, default_peak_gflops,
+            utils::stof_safe, str, option_name, help);
+    if (parsed) peak_gflops = MAX2(0., peak_gflops);
+    return parsed;
+}
+
 static bool parse_repeats_per_prb(
         const char *str, const std::string &option_name = "repeats-per-prb") {
     static const std::string help
@@ -1853,9 +1902,10 @@ bool parse_bench_settings(const char *str) {
             || parse_cpu_isa_hints(str) || parse_engine(str)
             || parse_fast_ref(str) || parse_fix_times_per_prb(str)
             || parse_global_impl(str) || parse_global_skip_impl(str)
-            || parse_max_ms_per_prb(str) || parse_num_streams(str)
-            || parse_repeats_per_prb(str) || parse_mem_check(str)
-            || parse_memory_kind(str) || parse_mode(str)
+            || parse_max_ms_per_prb(str) || parse_num_instances(str)
+            || parse_num_streams(str) || parse_peak_gbps(str)
+            || parse_peak_gflops(str) || parse_repeats_per_prb(str)
+            || parse_mem_check(str) || parse_memory_kind(str) || parse_mode(str)
             || parse_mode_modifier(str) || parse_start(str)
             || parse_stream_kind(str) || parse_summary(str)
             || parse_verbose(str) || parse_execution_mode(str)
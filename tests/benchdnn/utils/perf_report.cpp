@@ -19,6 +19,7 @@
 #include "dnnl_common.hpp"
 
 #include "utils/perf_report.hpp"
+#include "utils/roofline.hpp"
 
 void base_perf_report_t::report(res_t *res, const char *prb_str) const {
     dump_perf_header();
@@ -82,6 +83,39 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ticks(mode) / t.sec(mode) / unit;
     };
 
+    // Instances of a problem run concurrently, so the throughput is based on
+    // the wall time rather than on the sum of execution times.
+    auto get_agg_flops = [&]() -> double {
+        const auto &tt
+                = res->timer_map.get_timer(timer::names::throughput_timer);
+        const auto &t = tt.times() ? tt : res->timer_map.perf_timer();
+        if (!t.total_ms()) return 0;
+        return ops() * t.times() / (t.total_ms() / 1e3) / unit;
+    };
+
+    // Roofline model: a problem with arithmetic intensity below the ratio of
+    // the peak compute to the peak bandwidth is bound by memory.
+    const double iobytes = res->ibytes + res->obytes;
+    const double ai = iobytes ? ops() / iobytes : 0;
+    auto get_peak_ops = [&]() { return roofline::peak_ops(compute_dt()); };
+
+    auto get_bound = [&]() -> const char * {
+        const double peak_ops = get_peak_ops();
+        const double peak_bw = roofline::peak_bw();
+        if (!peak_ops || !peak_bw) return "undef";
+        return ai < peak_ops / peak_bw ? "memory" : "compute";
+    };
+
+    // Percentage of the performance attainable for the arithmetic intensity.
+    // Problems without operations are compared to the peak bandwidth.
+    auto get_roofline = [&](const timer::timer_t &t) -> double {
+        if (!t.sec(mode)) return 0;
+        const double peak_bw = roofline::peak_bw();
+        if (!ops()) return peak_bw ? 100. * get_bw(t) * unit / peak_bw : 0;
+        const double attainable = MIN2(get_peak_ops(), ai * peak_bw);
+        return attainable ? 100. * get_flops(t) * unit / attainable : 0;
+    };
+
     auto get_create_time = [&](const timer::timer_t &t) -> double {
         // If user didn't ask for mode, choose the maximum one to return time
         // for no-cache-hit creation.
@@ -142,6 +176,16 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("iobytes", s << (res->ibytes + res->obytes) / unit);
     HANDLE("idx", s << benchdnn_stat.tests);
     HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("p50", s << res->timer_map.perf_timer().percentile(50) / unit);
+    HANDLE("p90", s << res->timer_map.perf_timer().percentile(90) / unit);
+    HANDLE("p99", s << res->timer_map.perf_timer().percentile(99) / unit);
+    HANDLE("p999", s << res->timer_map.perf_timer().percentile(99.9) / unit);
+    HANDLE("agg_flops", s << get_agg_flops());
+    HANDLE("ai", s << ai);
+    HANDLE("bound", s << get_bound());
+    HANDLE("roofline", s << get_roofline(res->timer_map.perf_timer()));
+    HANDLE("peak_flops", s << get_peak_ops() / unit);
+    HANDLE("peak_bw", s << roofline::peak_bw() / unit);
     HANDLE("ctime",
             s << get_create_time(res->timer_map.cp_timer())
                             + get_create_time(res->timer_map.cpd_timer()));
@@ -157,11 +201,42 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     SAFE_V(FAIL);
 }
 
+dnnl_data_type_t base_perf_report_t::compute_dt() const {
+    // The widest of source and weights data types defines the computations,
+    // e.g. f32 for a problem with weights decompression.
+    std::vector<dnnl_data_type_t> dts;
+    if (sdt() && !sdt()->empty()) {
+        dts.push_back((*sdt())[0]);
+        if (sdt()->size() > 1) dts.push_back((*sdt())[1]);
+    } else if (dt()) {
+        dts.push_back(*dt());
+    }
+    dnnl_data_type_t res = dnnl_f32;
+    size_t res_size = 0;
+    for (auto dt : dts) {
+        const size_t size = dnnl_data_type_size(dt);
+        if (size > res_size) {
+            res = dt;
+            res_size = size;
+        }
+    }
+    return res;
+}
+
 void base_perf_report_t::dump_perf_header() const {
 
     static bool header_printed = false;
     if (header_printed) return;
 
+    // Estimate the peaks before reporting any problem so that the estimation
+    // does not interleave with the report.
+    for (const char *opt : {"bound%", "roofline%", "peak_flops%", "peak_bw%"}) {
+        if (strstr(pt_, opt)) {
+            roofline::init();
+            break;
+        }
+    }
+
     BENCHDNN_PRINT(0, "Template entries: %s\n", pt_);
 
     // Process template into a CSV friendly header, which can be easily processed as a
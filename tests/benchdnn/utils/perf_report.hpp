@@ -77,6 +77,9 @@ private:
 
     void dump_perf_header() const;
 
+    // Data type used for computations, which defines the peak compute.
+    dnnl_data_type_t compute_dt() const;
+
     static timer::timer_t::mode_t modifier2mode(char c) {
         if (c == '-') return timer::timer_t::min;
         if (c == '0') return timer::timer_t::avg;
@@ -0,0 +1,289 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+
+#include "utils/dnnl_query.hpp"
+#include "utils/replay.hpp"
+#include "utils/timer.hpp"
+#include "utils/wrapper.hpp"
+
+namespace replay {
+
+namespace {
+
+struct layer_t {
+    std::string label;
+    std::string impl_name;
+    thr_ctx_t ctx;
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> prim;
+    // Copies of the original arguments. Arguments sharing a memory object in
+    // the original problem (e.g., in-place) share a copy.
+    std::vector<std::unique_ptr<dnn_mem_t>> mems;
+    std::vector<std::pair<int, int>> arg_mem_idx;
+    // Memories placed in the activation buffers, created by `run`.
+    std::vector<std::unique_ptr<dnn_mem_t>> act_mems;
+    std::vector<dnnl_exec_arg_t> dnnl_args;
+    timer::timer_t t;
+};
+
+bool recording = false;
+std::string next_label;
+std::vector<layer_t> layers;
+
+const_dnnl_memory_desc_t mem_md(const layer_t &l, int arg) {
+    for (const auto &e : l.arg_mem_idx)
+        if (e.first == arg) return l.mems[e.second]->md_;
+    return nullptr;
+}
+
+void reset_dnnl_args(layer_t &l) {
+    l.dnnl_args.clear();
+    for (const auto &e : l.arg_mem_idx)
+        l.dnnl_args.push_back({e.first, l.mems[e.second]->m_});
+}
+
+int mem_idx(const layer_t &l, int arg) {
+    for (const auto &e : l.arg_mem_idx)
+        if (e.first == arg) return e.second;
+    return -1;
+}
+
+// The destination of a forward layer is placed in one of two activation
+// buffers, and the source of the next layer is taken from the buffer the
+// previous destination was written to when their descriptors match. This
+// keeps the activations flowing through the same memory as in the model
+// instead of each layer reading its own warm copy.
+//
+// Only host memory may be aliased this way, so GPU layers keep their copies.
+int place_activations(std::vector<dnn_mem_t> &buffers) {
+    const auto &engine = get_test_engine();
+    if (!is_cpu(engine) || is_sycl_engine(engine)) return OK;
+
+    struct placement_t {
+        int src_buf = -1;
+        int dst_buf = -1;
+    };
+    std::vector<placement_t> placements(layers.size());
+
+    size_t buf_size = 0;
+    int last_buf = 1;
+    const_dnnl_memory_desc_t last_md = nullptr;
+    for (size_t i = 0; i < layers.size(); i++) {
+        const auto &l = layers[i];
+        const int src_idx = mem_idx(l, DNNL_ARG_SRC);
+        const int dst_idx = mem_idx(l, DNNL_ARG_DST);
+        if (src_idx < 0 || dst_idx < 0 || mem_idx(l, DNNL_ARG_DIFF_DST) >= 0)
+            continue;
+
+        const auto src_md = mem_md(l, DNNL_ARG_SRC);
+        const auto dst_md = mem_md(l, DNNL_ARG_DST);
+        auto &p = placements[i];
+        if (last_md && dnnl_memory_desc_equal(src_md, last_md))
+            p.src_buf = last_buf;
+        const bool in_place = src_idx == dst_idx;
+        p.dst_buf = in_place && p.src_buf >= 0 ? p.src_buf : 1 - last_buf;
+        if (in_place) p.src_buf = p.dst_buf;
+
+        buf_size = std::max(buf_size, dnnl_memory_desc_get_size(dst_md));
+        if (p.src_buf >= 0)
+            buf_size = std::max(buf_size, dnnl_memory_desc_get_size(src_md));
+        last_buf = p.dst_buf;
+        last_md = dst_md;
+    }
+    if (buf_size == 0) return OK;
+
+    const dnnl_dims_t dims {static_cast<dnnl_dim_t>(buf_size)};
+    for (int b = 0; b < 2; b++)
+        buffers.emplace_back(1, dims, dnnl_u8, tag::abx, engine,
+                /* prefill = */ true);
+
+    std::vector<void *> ptrs;
+    for (auto &b : buffers) {
+        void *ptr = nullptr;
+        DNN_SAFE(dnnl_memory_get_data_handle(b.m_, &ptr), WARN);
+        ptrs.push_back(ptr);
+    }
+
+    for (size_t i = 0; i < layers.size(); i++) {
+        auto &l = layers[i];
+        const auto &p = placements[i];
+        if (p.dst_buf < 0) continue;
+        for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+            const int buf = arg == DNNL_ARG_SRC ? p.src_buf : p.dst_buf;
+            if (buf < 0) continue;
+            l.act_mems.emplace_back(new dnn_mem_t(mem_md(l, arg), engine,
+                    /* prefill = */ false, {/* is_host_ptr = */ true,
+                            ptrs[buf]}));
+            auto &m = *l.act_mems.back();
+            if (m.is_mapped()) m.unmap();
+            for (auto &a : l.dnnl_args)
+                if (a.arg == arg) a.memory = m.m_;
+        }
+    }
+    return OK;
+}
+
+int execute_layers(stream_t &stream, res_t *res) {
+    // Warm-up pass, which also touches the activation buffers.
+    for (auto &l : layers) {
+        DNN_SAFE(dnnl_primitive_execute(l.prim, stream,
+                         static_cast<int>(l.dnnl_args.size()),
+                         l.dnnl_args.data()),
+                WARN);
+    }
+    DNN_SAFE(dnnl_stream_wait(stream), CRIT);
+
+    auto &total_t = res->timer_map.perf_timer();
+    total_t.reset();
+    for (auto &l : layers)
+        l.t.reset();
+
+    // Each layer is waited for to time it separately. On devices this adds a
+    // synchronization the model doesn't have, while on CPU it is free.
+    while (true) {
+        total_t.start();
+        for (auto &l : layers) {
+            l.t.start();
+            DNN_SAFE(dnnl_primitive_execute(l.prim, stream,
+                             static_cast<int>(l.dnnl_args.size()),
+                             l.dnnl_args.data()),
+                    WARN);
+            DNN_SAFE(dnnl_stream_wait(stream), CRIT);
+            l.t.stamp();
+        }
+        total_t.stamp();
+        if (should_stop(total_t)) break;
+    }
+    return OK;
+}
+
+} // namespace
+
+bool is_recording() {
+    return recording;
+}
+
+void set_recording(bool value) {
+    recording = value;
+}
+
+void set_label(const std::string &label) {
+    next_label = label;
+}
+
+int record(const thr_ctx_t &ctx, res_t *res, dnnl_primitive_t prim,
+        const args_t &args) {
+    const auto &engine = get_test_engine();
+
+    layer_t l;
+    l.label = next_label;
+    l.ctx = ctx;
+
+    // The primitive is owned by the driver and destroyed with the problem.
+    // A new one is created from the same descriptor, which is a primitive
+    // cache hit.
+    const_dnnl_primitive_desc_t pd = query_pd(prim);
+    dnnl_primitive_t prim_copy {};
+    DNN_SAFE(dnnl_primitive_create(&prim_copy, pd), WARN);
+    l.prim.reset(prim_copy);
+    l.impl_name = query_impl_info(pd);
+
+    std::unordered_map<const dnn_mem_t *, int> copies;
+    for (int i = 0; i < args.size(); i++) {
+        const auto &m = args.dnn_mem(i);
+        const auto it = copies.find(&m);
+        if (it != copies.end()) {
+            l.arg_mem_idx.emplace_back(args.arg(i), it->second);
+            continue;
+        }
+
+        const int idx = static_cast<int>(l.mems.size());
+        l.mems.emplace_back(
+                new dnn_mem_t(m.md_, engine, /* prefill = */ true));
+        SAFE(l.mems.back()->reorder(m), WARN);
+        copies.emplace(&m, idx);
+        l.arg_mem_idx.emplace_back(args.arg(i), idx);
+    }
+
+    for (const auto &e : l.arg_mem_idx) {
+        auto &m = *l.mems[e.second];
+        if (m.is_mapped()) m.unmap();
+    }
+    reset_dnnl_args(l);
+
+    layers.push_back(std::move(l));
+    res->state = EXECUTED;
+    return OK;
+}
+
+int run(const std::string &title) {
+    if (layers.empty()) {
+        BENCHDNN_PRINT(0, "%s\n", "Error: no primitives to replay.");
+        return FAIL;
+    }
+
+    std::vector<dnn_mem_t> buffers;
+    SAFE(place_activations(buffers), WARN);
+    for (auto &b : buffers)
+        if (b.is_mapped()) b.unmap();
+
+    res_t res {};
+    res_t *res_ptr = &res;
+    const auto &ctx = layers.front().ctx;
+    stream_t stream(get_test_engine(), ctx.get_interop_obj());
+    SAFE(execute_in_thr_ctx(ctx, execute_layers, stream, res_ptr), WARN);
+
+    const auto &total_t = res.timer_map.perf_timer();
+    const double total_avg = total_t.ms(timer::timer_t::avg);
+    for (size_t i = 0; i < layers.size(); i++) {
+        const auto &l = layers[i];
+        const double avg = l.t.ms(timer::timer_t::avg);
+        BENCHDNN_PRINT(0, "replay,%d,%g,%g,%.1f%%,%s,%s\n", (int)i,
+                l.t.ms(timer::timer_t::min), avg,
+                total_avg > 0 ? 100. * avg / total_avg : 0.,
+                l.impl_name.c_str(), l.label.c_str());
+    }
+    BENCHDNN_PRINT(0,
+            "replay total: %s layers:%d passes:%d min:%g avg:%g p50:%g "
+            "p99:%g\n",
+            title.c_str(), (int)layers.size(), total_t.times(),
+            total_t.ms(timer::timer_t::min), total_avg,
+            total_t.percentile(50), total_t.percentile(99));
+
+    // Memories placed in the buffers must go before the buffers do.
+    for (auto &l : layers) {
+        l.act_mems.clear();
+        reset_dnnl_args(l);
+    }
+    return OK;
+}
+
+void clear() {
+    layers.clear();
+    next_label.clear();
+}
+
+} // namespace replay
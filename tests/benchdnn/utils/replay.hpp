@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_REPLAY_HPP
+#define UTILS_REPLAY_HPP
+
+#include <string>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "tests/test_thread.hpp"
+
+#include "utils/res.hpp"
+
+struct args_t;
+
+// Recorder of primitive sequences for the replay driver.
+//
+// While recording is on, `measure_perf` doesn't time a primitive but appends
+// it to the sequence together with copies of its arguments. `run` then
+// executes the whole sequence in the recorded order and reports per-layer and
+// end-to-end times.
+namespace replay {
+
+bool is_recording();
+void set_recording(bool recording);
+
+// Sets the problem line the next recorded primitive is reported with.
+void set_label(const std::string &label);
+
+int record(const thr_ctx_t &ctx, res_t *res, dnnl_primitive_t prim,
+        const args_t &args);
+
+// Executes the recorded sequence and prints the report. `title` is printed
+// in the total line to distinguish several runs of the same sequence.
+int run(const std::string &title);
+
+// Destroys the recorded sequence.
+void clear();
+
+} // namespace replay
+
+#endif
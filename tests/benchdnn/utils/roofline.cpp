@@ -0,0 +1,208 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common.hpp"
+#include "dnnl_common.hpp"
+
+#include "utils/parallel.hpp"
+#include "utils/roofline.hpp"
+
+double default_peak_gflops = 0;
+double peak_gflops = default_peak_gflops;
+double default_peak_gbps = 0;
+double peak_gbps = default_peak_gbps;
+
+namespace roofline {
+
+namespace {
+
+double ms_now() {
+    return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+bool has_isa(dnnl_cpu_isa_t isa, dnnl_cpu_isa_t feature) {
+    return (static_cast<unsigned>(isa) & static_cast<unsigned>(feature))
+            == static_cast<unsigned>(feature);
+}
+
+// Operations per cycle per core. The numbers assume two FMA units for vector
+// instructions and are a rough estimate for the ISA without AMX or VNNI
+// support for a data type, where the computations go through up-conversion.
+double ops_per_cycle(dnnl_data_type_t dt) {
+    const dnnl_cpu_isa_t isa = dnnl_get_effective_cpu_isa();
+
+    double f32_ops = 0;
+    if (has_isa(isa, dnnl_cpu_isa_avx512_core))
+        f32_ops = 64;
+    else if (has_isa(isa, dnnl_cpu_isa_avx2))
+        f32_ops = 32;
+    else if (has_isa(isa, dnnl_cpu_isa_avx))
+        f32_ops = 16;
+    else if (has_isa(isa, dnnl_cpu_isa_sse41))
+        f32_ops = 8;
+    // Unknown ISA, e.g. on non-x64 platforms.
+    if (f32_ops == 0) return 0;
+
+    switch (dt) {
+        case dnnl_f64: return f32_ops / 2;
+        case dnnl_bf16:
+            if (has_isa(isa, dnnl_cpu_isa_avx10_1_512_amx)) return 1024;
+            if (has_isa(isa, dnnl_cpu_isa_avx512_core_bf16)) return 128;
+            return f32_ops;
+        case dnnl_f16:
+            if (has_isa(isa, dnnl_cpu_isa_avx10_1_512_amx_fp16)) return 1024;
+            if (has_isa(isa, dnnl_cpu_isa_avx10_1_512)) return 128;
+            return f32_ops;
+        case dnnl_f8_e5m2:
+        case dnnl_f8_e4m3:
+            if (has_isa(isa, dnnl_cpu_isa_avx10_2_512_amx_2)) return 2048;
+            if (has_isa(isa, dnnl_cpu_isa_avx10_1_512_amx_fp16)) return 1024;
+            return f32_ops;
+        case dnnl_s8:
+        case dnnl_u8:
+        case dnnl_s4:
+        case dnnl_u4:
+            if (has_isa(isa, dnnl_cpu_isa_avx10_1_512_amx)) return 2048;
+            if (has_isa(isa, dnnl_cpu_isa_avx512_core_vnni)) return 256;
+            if (has_isa(isa, dnnl_cpu_isa_avx2_vnni)) return 128;
+            return 2 * f32_ops;
+        default: return f32_ops;
+    }
+}
+
+// Measures the frequency with a chain of dependent additions, one per cycle,
+// running on all threads at once. Returns the average over the threads.
+double measure_freq() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    constexpr int64_t n_iters = 1 << 24;
+    const int nthr = benchdnn_get_max_threads();
+    std::vector<double> freqs(nthr, 0);
+    benchdnn_parallel_nd(nthr, [&](int64_t ithr) {
+        uint64_t x = static_cast<uint64_t>(ithr);
+        const double start_ms = ms_now();
+        for (int64_t i = 0; i < n_iters; i += 4) {
+            // Empty asm statements prevent the compiler from merging
+            // additions.
+            x += 1;
+            __asm__ volatile("" : "+r"(x));
+            x += 3;
+            __asm__ volatile("" : "+r"(x));
+            x += 5;
+            __asm__ volatile("" : "+r"(x));
+            x += 7;
+            __asm__ volatile("" : "+r"(x));
+        }
+        const double ms = ms_now() - start_ms;
+        if (ms > 0) freqs[ithr] = n_iters / ms * 1e3;
+    });
+
+    double sum = 0;
+    int n = 0;
+    for (double f : freqs) {
+        if (f == 0) continue;
+        sum += f;
+        n++;
+    }
+    return n ? sum / n : 0;
+#else
+    return 0;
+#endif
+}
+
+double measure_bw() {
+    // Each buffer is much larger than the last level caches of most CPUs.
+    constexpr int64_t n_elems = 1 << 25;
+    constexpr int n_runs = 5;
+    const int64_t nchunks = 16 * benchdnn_get_max_threads();
+    const int64_t chunk = div_up(n_elems, nchunks);
+
+    std::unique_ptr<float[]> src(new float[n_elems]);
+    std::unique_ptr<float[]> dst(new float[n_elems]);
+    // Pages are first touched by the threads which will access them.
+    benchdnn_parallel_nd(nchunks, [&](int64_t ichunk) {
+        const int64_t end = MIN2((ichunk + 1) * chunk, n_elems);
+        for (int64_t i = ichunk * chunk; i < end; i++) {
+            src[i] = 1.f;
+            dst[i] = 0.f;
+        }
+    });
+
+    double best_ms = 0;
+    for (int run = 0; run < n_runs; run++) {
+        const float scale = 1.f + run;
+        const double start_ms = ms_now();
+        benchdnn_parallel_nd(nchunks, [&](int64_t ichunk) {
+            const int64_t end = MIN2((ichunk + 1) * chunk, n_elems);
+            for (int64_t i = ichunk * chunk; i < end; i++)
+                dst[i] = scale * src[i];
+        });
+        const double ms = ms_now() - start_ms;
+        if (run == 0 || ms < best_ms) best_ms = ms;
+    }
+    if (best_ms <= 0) return 0;
+    // The write-allocate traffic is not counted, same as for the bandwidth
+    // reported for problems.
+    return 2. * n_elems * sizeof(float) / best_ms * 1e3;
+}
+
+double measured_freq() {
+    static const double freq = is_cpu() ? measure_freq() : 0;
+    return freq;
+}
+
+double measured_bw() {
+    static const double bw = is_cpu() ? measure_bw() : 0;
+    return bw;
+}
+
+} // namespace
+
+double peak_ops(dnnl_data_type_t dt) {
+    if (peak_gflops > 0) return peak_gflops * 1e9;
+    return benchdnn_get_max_threads() * measured_freq() * ops_per_cycle(dt);
+}
+
+double peak_bw() {
+    if (peak_gbps > 0) return peak_gbps * 1e9;
+    return measured_bw();
+}
+
+void init() {
+    static bool initialized = false;
+    if (initialized) return;
+    initialized = true;
+
+    if (peak_gflops > 0) {
+        BENCHDNN_PRINT(0, "Roofline peak compute: %g GFLOPS\n", peak_gflops);
+    } else {
+        BENCHDNN_PRINT(0,
+                "Roofline peak compute: %d threads at %g GHz, f32 peak %g "
+                "GFLOPS\n",
+                benchdnn_get_max_threads(), measured_freq() / 1e9,
+                peak_ops(dnnl_f32) / 1e9);
+    }
+    BENCHDNN_PRINT(0, "Roofline peak bandwidth: %g GB/s\n", peak_bw() / 1e9);
+}
+
+} // namespace roofline
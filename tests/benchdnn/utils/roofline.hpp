@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_ROOFLINE_HPP
+#define UTILS_ROOFLINE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+// Peaks used by the roofline model of the performance report. A value of `0`
+// means the peak is estimated on the machine, which is supported for CPU only.
+extern double default_peak_gflops;
+extern double peak_gflops;
+extern double default_peak_gbps;
+extern double peak_gbps;
+
+namespace roofline {
+
+// Returns the peak compute in operations per second for a data type used for
+// computations. When not provided by the user, it is estimated as the number
+// of threads times the measured frequency times the throughput per cycle of
+// the effective ISA for `dt`. Returns `0` if the peak is unknown.
+double peak_ops(dnnl_data_type_t dt);
+
+// Returns the peak memory bandwidth in bytes per second. When not provided by
+// the user, it is measured with a parallel copy of buffers much larger than
+// the caches. Returns `0` if the peak is unknown.
+double peak_bw();
+
+// Estimates the peaks which were not provided by the user and prints them.
+void init();
+
+} // namespace roofline
+
+#endif
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "common.hpp"
+#include "utils/replay.hpp"
 #include "utils/wrapper.hpp"
 
 template <typename prb_t, typename perf_report_t, typename create_func_t,
@@ -118,7 +119,7 @@ private:
     int report() {
         const prb_t *prb = &prb_;
         parse_result(res_, prb_.str());
-        if (has_bench_mode_bit(mode_bit_t::perf)) {
+        if (has_bench_mode_bit(mode_bit_t::perf) && !replay::is_recording()) {
             perf_report_t pr(prb, perf_template_.c_str());
             pr.report(&res_, prb_.str());
         }
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "common.hpp"
 #include "utils/timer.hpp"
@@ -43,6 +44,24 @@ uint64_t ticks_now() {
 }
 #endif
 
+namespace {
+// Histogram buckets cover times from 10 ns to about 4 minutes.
+constexpr double hist_min_ms = 1e-5;
+constexpr double hist_ratio = 1.01;
+constexpr int hist_nbuckets = 2400;
+
+int hist_bucket(double ms) {
+    if (ms <= hist_min_ms) return 0;
+    const int b = (int)(std::log(ms / hist_min_ms) / std::log(hist_ratio));
+    return std::min(b, hist_nbuckets - 1);
+}
+
+// Geometric center of a bucket.
+double hist_value(int b) {
+    return hist_min_ms * std::pow(hist_ratio, b + 0.5);
+}
+} // namespace
+
 void timer_t::reset() {
     times_ = 0;
     for (int i = 0; i < n_modes; ++i)
@@ -51,6 +70,7 @@ void timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    hist_.clear();
 
     start();
 }
@@ -85,9 +105,49 @@ void timer_t::stop(int add_times, int64_t add_ticks, double add_ms) {
     ticks_[mode_t::max]
             = times_ ? std::max(ticks_[mode_t::max], d_ticks) : d_ticks;
 
+    if (hist_.empty()) hist_.resize(hist_nbuckets, 0);
+    hist_[hist_bucket(d_ms)] += add_times;
+
     times_ += add_times;
 }
 
+double timer_t::percentile(double p) const {
+    if (!times() || hist_.empty()) return 0;
+
+    const double target = std::max(1., std::ceil(p / 100. * times()));
+    double count = 0;
+    int b = 0;
+    for (; b < hist_nbuckets - 1; b++) {
+        count += hist_[b];
+        if (count >= target) break;
+    }
+    // Saturate the estimation to the exact bounds.
+    return std::min(
+            ms_[mode_t::max], std::max(ms_[mode_t::min], hist_value(b)));
+}
+
+void timer_t::merge(const timer_t &other) {
+    if (!other.times()) return;
+    if (!times()) {
+        *this = other;
+        return;
+    }
+
+    for (auto mode : {mode_t::avg, mode_t::sum}) {
+        ms_[mode] += other.ms_[mode];
+        ticks_[mode] += other.ticks_[mode];
+    }
+    ms_[mode_t::min] = std::min(ms_[mode_t::min], other.ms_[mode_t::min]);
+    ms_[mode_t::max] = std::max(ms_[mode_t::max], other.ms_[mode_t::max]);
+    ticks_[mode_t::min]
+            = std::min(ticks_[mode_t::min], other.ticks_[mode_t::min]);
+    ticks_[mode_t::max]
+            = std::max(ticks_[mode_t::max], other.ticks_[mode_t::max]);
+    for (int b = 0; b < hist_nbuckets; b++)
+        hist_[b] += other.hist_[b];
+    times_ += other.times_;
+}
+
 void timer_t::stamp(int add_times) {
     stop(add_times, ticks_now() - ticks_start_, ms_now() - ms_start_);
 }
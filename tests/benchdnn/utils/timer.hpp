@@ -19,6 +19,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #define TIME_FUNC(func, res, name) \
     do { \
@@ -79,6 +80,15 @@ struct timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    // Returns the time in milliseconds which `p` percent of measurements do
+    // not exceed. The value comes from a histogram of measurements with a
+    // relative resolution of 1%. Measurements stamped in batches contribute
+    // the average time of a batch.
+    double percentile(double p) const;
+
+    // Accumulates measurements of another timer, e.g. collected concurrently.
+    void merge(const timer_t &other);
+
     timer_t(const timer_t &rhs) = default;
     timer_t &operator=(const timer_t &rhs);
     timer_t &operator=(timer_t &&rhs) = default;
@@ -86,6 +96,9 @@ struct timer_t {
     int times_;
     uint64_t ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    // Number of measurements per logarithmic time bucket. Allocated with the
+    // first measurement.
+    std::vector<uint32_t> hist_;
 };
 
 // Designated timers to support benchdnn performance reporting and general time
@@ -103,6 +116,8 @@ const std::string cp_timer = "create_prim_timer";
 const std::string compare_timer = "compare_timer";
 // Driver's memory filling.
 const std::string fill_timer = "fill_timer";
+// Wall time of concurrent executions of a problem to report the throughput.
+const std::string throughput_timer = "throughput_timer";
 // Test case timer from the create function till dumping the output.
 const std::string test_case_timer = "test_case_timer";
 // Driver's execute.
@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl.hpp"
 
 #include <tuple>
 
@@ -30,7 +31,7 @@ static bool are_valid_flags(
     if (engine_kind == dnnl_gpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
 #endif
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     if (engine_kind == dnnl_cpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
 #endif
@@ -137,6 +138,117 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+TEST(stream_test_cpp_t, OutOfOrderCpuDependencies) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::out_of_order);
+
+    const memory::dim n = 1024;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto linear_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            2.f, 1.f);
+    eltwise_forward linear(linear_pd);
+
+    // Two independent chains of dependent primitives: a -> b -> a and
+    // c -> d -> c. Each step computes 2 * x + 1.
+    memory a(md, eng), b(md, eng), c(md, eng), d(md, eng);
+    for (auto *m : {&a, &c}) {
+        float *ptr = static_cast<float *>(m->get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = static_cast<float>(i % 7);
+    }
+
+    const int nsteps = 4;
+    for (int step = 0; step < nsteps; step++) {
+        linear.execute(s, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+        linear.execute(s, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, d}});
+        linear.execute(s, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, a}});
+        linear.execute(s, {{DNNL_ARG_SRC, d}, {DNNL_ARG_DST, c}});
+    }
+    s.wait();
+
+    for (auto *m : {&a, &c}) {
+        const float *ptr = static_cast<const float *>(m->get_data_handle());
+        for (memory::dim i = 0; i < n; i++) {
+            float expected = static_cast<float>(i % 7);
+            for (int step = 0; step < 2 * nsteps; step++)
+                expected = 2.f * expected + 1.f;
+            ASSERT_EQ(ptr[i], expected);
+        }
+    }
+}
+#endif
+
+#if defined(__linux__) && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_TBB
+TEST(stream_test_cpp_t, CpuAffinity) {
+    engine eng(engine::kind::cpu, 0);
+    EXPECT_ANY_THROW(stream(eng, std::vector<int> {}));
+    EXPECT_ANY_THROW(stream(eng, std::vector<int> {-1}));
+
+    const memory::dim n = 256;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward relu(relu_pd);
+
+    for (auto flags : {stream::flags::in_order, stream::flags::out_of_order}) {
+        stream s(eng, std::vector<int> {0}, flags);
+        memory src(md, eng), dst(md, eng);
+        float *src_ptr = static_cast<float *>(src.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            src_ptr[i] = static_cast<float>(i - n / 2);
+
+        relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        const float *dst_ptr
+                = static_cast<const float *>(dst.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(dst_ptr[i], std::max(0.f, src_ptr[i]));
+    }
+}
+#endif
+
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, CpuProfiling) {
+    engine eng(engine::kind::cpu, 0);
+
+    memory::desc md({2, 3, 4, 5}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto relu_pd = eltwise_forward::primitive_desc(eng, prop_kind::forward,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward relu(relu_pd);
+    memory mem(md, eng);
+
+    for (auto flags : {stream::flags::in_order, stream::flags::out_of_order}) {
+        stream s(eng, flags | stream::flags::profiling);
+        ASSERT_NO_THROW(reset_profiling(s));
+
+        const int nexecs = 3;
+        for (int i = 0; i < nexecs; i++)
+            relu.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        s.wait();
+
+        std::vector<uint64_t> nsec;
+        ASSERT_NO_THROW(
+                nsec = get_profiling_data(s, profiling_data_kind::time));
+        ASSERT_EQ(nsec.size(), (size_t)nexecs);
+
+        ASSERT_NO_THROW(reset_profiling(s));
+        ASSERT_NO_THROW(
+                nsec = get_profiling_data(s, profiling_data_kind::time));
+        ASSERT_TRUE(nsec.empty());
+    }
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
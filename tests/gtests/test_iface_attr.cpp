@@ -127,6 +127,57 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestStoreMode) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(store_mode::any, attr.get_store_mode());
+
+    for (auto m :
+            {store_mode::any, store_mode::regular, store_mode::nontemporal}) {
+        attr.set_store_mode(m);
+        ASSERT_EQ(m, attr.get_store_mode());
+    }
+}
+
+TEST_F(attr_test_t, TestStoreModeEx) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Store mode is a CPU-specific hint.");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    // The size is not a multiple of a vector length to exercise the tail
+    const memory::dim N = 3, C = 67, W = 129;
+    memory::desc data_md(
+            {N, C, W}, memory::data_type::f32, memory::format_tag::ncw);
+
+    for (auto m : {store_mode::regular, store_mode::nontemporal}) {
+        dnnl::primitive_attr attr;
+        attr.set_store_mode(m);
+        auto eltwise_pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu,
+                data_md, data_md, 0.f, attr);
+        ASSERT_EQ(m, eltwise_pd.get_primitive_attr().get_store_mode());
+
+        memory src(data_md, eng), dst(data_md, eng);
+        const size_t nelems = data_md.get_size() / sizeof(float);
+        {
+            auto src_ptr = map_memory<float>(src);
+            float *ptr = src_ptr;
+            for (size_t i = 0; i < nelems; i++)
+                ptr[i] = (i % 3 == 0) ? -1.f * i : 1.f * i;
+        }
+
+        eltwise_forward(eltwise_pd)
+                .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst);
+        const float *ptr = dst_ptr;
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(ptr[i], (i % 3 == 0) ? 0.f : 1.f * i);
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -127,6 +127,57 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestShardStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    const int nshards = get_primitive_cache_num_shards();
+    ASSERT_GT(nshards, 0);
+
+    auto get_totals = [&](uint64_t &hits, uint64_t &misses) {
+        hits = misses = 0;
+        for (int s = 0; s < nshards; s++) {
+            uint64_t h = 0, m = 0;
+            get_primitive_cache_shard_stats(s, h, m);
+            hits += h;
+            misses += m;
+        }
+    };
+
+    uint64_t hits0, misses0;
+    get_totals(hits0, misses0);
+
+    fill_primitive_cache(4);
+    fill_primitive_cache(4);
+
+    uint64_t hits1, misses1;
+    get_totals(hits1, misses1);
+    ASSERT_EQ(misses1 - misses0, 4u);
+    ASSERT_EQ(hits1 - hits0, 4u);
+
+    uint64_t h, m;
+    EXPECT_ANY_THROW(get_primitive_cache_shard_stats(nshards, h, m));
+}
+
+TEST(primitive_cache_test, TestMemoryBudget) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    fill_primitive_cache(4);
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+    // Nothing to evict when the cached primitives don't report any memory.
+    if (get_memory_usage(memory_usage_kind::total) == 0) return;
+    ASSERT_GE(get_memory_usage(memory_usage_kind::total, engine::kind::any,
+                      /* peak = */ true),
+            get_memory_usage(memory_usage_kind::total));
+
+    set_memory_budget(1);
+    ASSERT_EQ(get_memory_budget(), 1u);
+    fill_primitive_cache(5);
+    set_memory_budget(0);
+    ASSERT_LT(get_primitive_cache_size(), 5);
+}
 #endif
 
 } // namespace dnnl
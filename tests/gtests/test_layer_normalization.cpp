@@ -542,4 +542,77 @@ CPU_INST_TEST_CASE(LnormSimpleBF16F32, EXPAND_DTS(bf16, f32, bf16))
 CPU_INST_TEST_CASE(LnormSimpleF32S8, EXPAND_DTS(f32, s8, undef))
 CPU_INST_TEST_CASE(LnormSimpleBF16U8, EXPAND_DTS(bf16, u8, undef))
 
+// Checks that normalization with a residual matches normalization of the
+// explicitly computed sum, and that the sum is output.
+TEST(lnorm_residual_test_t, TestResidualAdd) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Residual is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    const memory::dims dims = {3, 4, 67};
+    const memory::dim nelems = 3 * 4 * 67;
+    const memory::desc data_md(
+            dims, memory::data_type::f32, memory::format_tag::tnc);
+
+    using flags = normalization_flags;
+    for (auto norm_flags : {flags::use_scale | flags::use_shift,
+                 flags::rms_norm | flags::use_scale}) {
+        auto fused_pd = layer_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_inference, data_md, data_md, epsilon,
+                norm_flags | flags::use_residual | flags::output_residual);
+        ASSERT_TRUE(fused_pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1)
+                == data_md);
+        ASSERT_TRUE(fused_pd.query_md(query::exec_arg_md, DNNL_ARG_DST_1)
+                == data_md);
+        auto plain_pd = layer_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_inference, data_md, data_md, epsilon,
+                norm_flags);
+
+        auto src = test::make_memory(data_md, eng);
+        auto residual = test::make_memory(data_md, eng);
+        auto sum = test::make_memory(data_md, eng);
+        auto ref_sum = test::make_memory(data_md, eng);
+        auto dst = test::make_memory(data_md, eng);
+        auto ref_dst = test::make_memory(data_md, eng);
+        auto scale = test::make_memory(fused_pd.weights_desc(), eng);
+        auto shift = test::make_memory(fused_pd.weights_desc(), eng);
+
+        fill_data<float>(nelems, src, 1.f, 2.f);
+        fill_data<float>(nelems, residual, -0.5f, 1.f);
+        fill_data<float>(dims[2], scale, 1.f, 0.5f);
+        fill_data<float>(dims[2], shift, 0.f, 0.5f);
+        {
+            auto src_ptr = map_memory<float>(src);
+            auto residual_ptr = map_memory<float>(residual);
+            auto ref_sum_ptr = map_memory<float>(ref_sum);
+            for (memory::dim i = 0; i < nelems; i++)
+                ref_sum_ptr[i] = src_ptr[i] + residual_ptr[i];
+        }
+
+        layer_normalization_forward(fused_pd)
+                .execute(strm,
+                        {{DNNL_ARG_SRC, src}, {DNNL_ARG_SRC_1, residual},
+                                {DNNL_ARG_DST, dst}, {DNNL_ARG_DST_1, sum},
+                                {DNNL_ARG_SCALE, scale},
+                                {DNNL_ARG_SHIFT, shift}});
+        layer_normalization_forward(plain_pd)
+                .execute(strm,
+                        {{DNNL_ARG_SRC, ref_sum}, {DNNL_ARG_DST, ref_dst},
+                                {DNNL_ARG_SCALE, scale},
+                                {DNNL_ARG_SHIFT, shift}});
+        strm.wait();
+
+        auto sum_ptr = map_memory<float>(sum);
+        auto ref_sum_ptr = map_memory<float>(ref_sum);
+        auto dst_ptr = map_memory<float>(dst);
+        auto ref_dst_ptr = map_memory<float>(ref_dst);
+        for (memory::dim i = 0; i < nelems; i++) {
+            ASSERT_EQ(sum_ptr[i], ref_sum_ptr[i]);
+            ASSERT_NEAR(dst_ptr[i], ref_dst_ptr[i], 1e-5f);
+        }
+    }
+}
+
 } // namespace dnnl